@@ -26,6 +26,5 @@ arduino-cli core install esp8266:esp8266 --additional-urls https://arduino.esp82
 arduino-cli lib install ArduinoJson@6.18.5
 arduino-cli lib install FastLED@3.4.0
 arduino-cli lib install WiFiManager@2.0.4-beta
-arduino-cli lib install NTPClient@3.2.0
 
 arduino-cli compile --fqbn esp8266:esp8266:d1_mini ./esp8266-fastled-webserver/esp8266-fastled-webserver.ino
@@ -0,0 +1,18 @@
+#!/bin/bash
+
+# Exit immediately if a command exits with a non-zero status.
+set -e
+
+# Make sure we are inside the github workspace
+cd $GITHUB_WORKSPACE
+
+# Install PlatformIO CLI
+export PATH=$PATH:~/.platformio/penv/bin
+curl -fsSL https://raw.githubusercontent.com/platformio/platformio-core-installer/master/get-platformio.py -o get-platformio.py
+python3 get-platformio.py
+
+# Run the host unit tests and benchmarks (test/); the native environment's
+# pre: script generates the web asset bundle, which is checked here as well,
+# as test/test_web_assets cannot build without it
+pio test --environment native
+test -f esp8266-fastled-webserver/include/generated/WebAssets.h
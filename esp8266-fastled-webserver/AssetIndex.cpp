@@ -0,0 +1,255 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+#include <algorithm>
+#include <vector>
+
+// sorted by path
+static std::vector<Asset> assets;
+
+static bool pathLess(const Asset& asset, const String& path) {
+  return strcmp(asset.path.c_str(), path.c_str()) < 0;
+}
+
+static std::vector<Asset>::iterator lowerBound(const String& path) {
+  return std::lower_bound(assets.begin(), assets.end(), path, pathLess);
+}
+
+static uint32_t bytesHashed = 0; // since boot
+
+static uint32_t hashFile(File& file) {
+  uint8_t buffer[256];
+  uint32_t hash = 2166136261u;
+  for (;;) {
+    const size_t count = file.read(buffer, sizeof(buffer));
+    if (count == 0) {
+      return hash;
+    }
+    bytesHashed += count;
+    for (size_t i = 0; i < count; i++) {
+      hash = (hash ^ buffer[i]) * 16777619u;
+    }
+    yield();
+  }
+}
+
+static String assetFsPath(const Asset& asset) {
+  return asset.gzipped ? asset.path + ".gz" : asset.path;
+}
+
+// The content hashes, kept on the file system between boots, so a boot reads
+// only the files it has not hashed before.  Each record is the file's size,
+// last write time and hash (uint32_t each), its path length (uint8_t), then its
+// path.  refreshAsset() rewrites it whenever a file changes; a new file system
+// image has none, so every file of it is hashed once.
+static const char ASSET_HASH_FILE[] = "/.assethashes";
+static const uint32_t ASSET_HASH_MAGIC = 0x31484641; // "AFH1"
+
+struct KnownHash {
+  String fsPath;
+  uint32_t size;
+  uint32_t lastWrite;
+  uint32_t hash;
+};
+
+static bool readUint32(File& file, uint32_t& value) {
+  return file.read(reinterpret_cast<uint8_t*>(&value), sizeof(value)) == sizeof(value);
+}
+static void writeUint32(File& file, uint32_t value) {
+  file.write(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+}
+
+static std::vector<KnownHash> readAssetHashes() {
+  std::vector<KnownHash> known;
+  File file = MYFS.open(ASSET_HASH_FILE, "r");
+  if (!file) {
+    return known;
+  }
+  uint32_t magic = 0;
+  if (readUint32(file, magic) && (magic == ASSET_HASH_MAGIC)) {
+    KnownHash entry;
+    uint8_t pathLength;
+    char path[256];
+    while (readUint32(file, entry.size) && readUint32(file, entry.lastWrite) && readUint32(file, entry.hash) &&
+           (file.read(&pathLength, 1) == 1) && (file.read(reinterpret_cast<uint8_t*>(path), pathLength) == pathLength)) {
+      path[pathLength] = '\0';
+      entry.fsPath = path;
+      known.push_back(entry);
+    }
+  }
+  file.close();
+  return known;
+}
+
+static void writeAssetHashes() {
+  File file = MYFS.open(ASSET_HASH_FILE, "w");
+  if (!file) {
+    LOG_WARN("Asset index: cannot write %s", ASSET_HASH_FILE);
+    return;
+  }
+  writeUint32(file, ASSET_HASH_MAGIC);
+  for (std::vector<Asset>::const_iterator asset = assets.begin(); asset != assets.end(); ++asset) {
+    const String fsPath = assetFsPath(*asset);
+    if (fsPath.length() > 255) {
+      continue; // hashed again at the next boot
+    }
+    const uint8_t pathLength = fsPath.length();
+    writeUint32(file, asset->size);
+    writeUint32(file, asset->lastWrite);
+    writeUint32(file, asset->hash);
+    file.write(&pathLength, 1);
+    file.write(reinterpret_cast<const uint8_t*>(fsPath.c_str()), pathLength);
+  }
+  file.close();
+}
+
+// Adds or replaces the entry for the file at fsPath; a .gz file replaces the
+// plain one, but not the other way around.  Returns the entry, or nullptr when
+// the plain file was not indexed.
+static Asset* indexFile(const String& fsPath, uint32_t size, time_t lastWrite, uint32_t hash) {
+  const bool gzipped = fsPath.endsWith(".gz");
+  const String path = gzipped ? fsPath.substring(0, fsPath.length() - 3) : fsPath;
+  std::vector<Asset>::iterator existing = lowerBound(path);
+  const bool found = (existing != assets.end()) && (existing->path == path);
+  if (found && existing->gzipped && !gzipped) {
+    return nullptr;
+  }
+
+  Asset asset;
+  asset.path = path;
+  asset.contentType = contentTypeForPath(path);
+  asset.size = size;
+  asset.lastWrite = (uint32_t)lastWrite;
+  asset.hash = hash;
+  asset.gzipped = gzipped;
+  if (found) {
+    *existing = asset;
+    return &*existing;
+  }
+  return &*assets.insert(existing, asset);
+}
+
+// Only the directory entries are read; the hashes are filled in afterwards
+static void indexDirectory(const String& directory) {
+  Dir dir = MYFS.openDir(directory);
+  while (dir.next()) {
+    const String fsPath = directory + dir.fileName();
+    if (dir.isDirectory()) {
+      indexDirectory(fsPath + "/");
+    } else if (fsPath != ASSET_HASH_FILE) {
+      indexFile(fsPath, dir.fileSize(), dir.fileTime(), 0);
+    }
+  }
+}
+
+// The hash of each indexed file: the one kept from an earlier boot, while the
+// file has the same size and write time, else read from the file.  Returns
+// whether any file was read.
+static bool hashAssets() {
+  const std::vector<KnownHash> known = readAssetHashes();
+  bool hashed = false;
+  for (std::vector<Asset>::iterator asset = assets.begin(); asset != assets.end(); ++asset) {
+    const String fsPath = assetFsPath(*asset);
+    std::vector<KnownHash>::const_iterator entry = known.begin();
+    while ((entry != known.end()) && (entry->fsPath != fsPath)) {
+      ++entry;
+    }
+    if ((entry != known.end()) && (entry->size == asset->size) && (entry->lastWrite == asset->lastWrite)) {
+      asset->hash = entry->hash;
+      continue;
+    }
+    File file = MYFS.open(fsPath, "r");
+    if (file) {
+      asset->hash = hashFile(file);
+      file.close();
+    }
+    hashed = true;
+  }
+  return hashed || (known.size() != assets.size());
+}
+
+// After the file at fsPath was written: its hash is read from the file itself,
+// as a write time of seconds since boot can repeat
+static void reindexFile(const String& fsPath) {
+  File file = MYFS.open(fsPath, "r");
+  if (!file) {
+    return;
+  }
+  const uint32_t size = file.size();
+  const time_t lastWrite = file.getLastWrite();
+  const uint32_t hash = hashFile(file);
+  file.close();
+  indexFile(fsPath, size, lastWrite, hash);
+}
+
+void buildAssetIndex() {
+  const uint32_t start = millis();
+  assets.clear();
+  bytesHashed = 0;
+  indexDirectory("/");
+  if (hashAssets()) {
+    writeAssetHashes();
+  }
+  LOG_INFO("Asset index: %u files in %lu ms, %lu bytes hashed (files not hashed at an earlier boot)",
+           (unsigned)assets.size(), (unsigned long)(millis() - start), (unsigned long)bytesHashed);
+}
+
+void refreshAsset(String fsPath) {
+  if (!fsPath.startsWith("/")) {
+    fsPath = "/" + fsPath;
+  }
+  if (fsPath == ASSET_HASH_FILE) {
+    return;
+  }
+  const String path = fsPath.endsWith(".gz") ? fsPath.substring(0, fsPath.length() - 3) : fsPath;
+  std::vector<Asset>::iterator existing = lowerBound(path);
+  if ((existing != assets.end()) && (existing->path == path)) {
+    assets.erase(existing);
+  }
+  // re-add whichever of the two files remains, .gz first
+  if (MYFS.exists(path + ".gz")) {
+    reindexFile(path + ".gz");
+  } else if (MYFS.exists(path)) {
+    reindexFile(path);
+  }
+  writeAssetHashes();
+}
+
+const Asset* findAsset(const String& path) {
+  std::vector<Asset>::iterator found = lowerBound(path);
+  if ((found != assets.end()) && (found->path == path)) {
+    return &*found;
+  }
+  return nullptr;
+}
+
+String formatETag(uint32_t hash, uint32_t size) {
+  char etag[20];
+  snprintf(etag, sizeof(etag), "\"%08x-%x\"", (unsigned)hash, (unsigned)size);
+  return String(etag);
+}
+
+String assetETag(const Asset& asset) {
+  return formatETag(asset.hash, asset.size);
+}
+
+uint16_t assetCount() {
+  return assets.size();
+}
@@ -6,75 +6,77 @@
 
 // Modified by Jason Coon to replace "magic numbers" with customizable inputs via sliders in the web app.
 
-void colorwavesPlayground( CRGB* ledarray, uint16_t numleds, CRGBPalette16& palette, bool useFibonacciOrder)
+// Not per template instance: both orders continue the same animation
+static uint16_t sColorwavesPlaygroundPseudotime = 0;
+static uint16_t sColorwavesPlaygroundLastMillis = 0;
+static uint16_t sColorwavesPlaygroundHue16 = 0;
+
+// ORDER is PIXEL_ORDER_REVERSED, optionally with PIXEL_ORDER_FIBONACCI
+template <PixelOrder ORDER>
+void colorwavesPlayground( CRGBPalette16& palette)
 {
-  static uint16_t sPseudotime = 0;
-  static uint16_t sLastMillis = 0;
-  static uint16_t sHue16 = 0;
-
   // uint8_t sat8 = beatsin88( 87, 220, 250);
   uint8_t brightdepth = beatsin88(brightDepthBpm * 256, brightDepthMin, brightDepthMax);
   uint16_t brightnessthetainc16 = beatsin88(brightThetaIncBpm, (brightThetaIncMin * 256), (brightThetaIncMax * 256));
 
   uint8_t msmultiplier = beatsin88(msMultiplierBpm, msMultiplierMin, msMultiplierMax);
 
-  uint16_t hue16 = sHue16;//gHue * 256;
+  const uint16_t hue16Start = sColorwavesPlaygroundHue16;//gHue * 256;
   uint16_t hueinc16 = beatsin88(hueIncBpm, hueIncMin, hueIncMax * 256);
 
-  uint16_t ms = millis();
-  uint16_t deltams = ms - sLastMillis ;
-  sLastMillis  = ms;
-  sPseudotime += deltams * msmultiplier;
-  sHue16 += deltams * beatsin88(sHueBpm * 256, sHueMin, sHueMax);
-  uint16_t brightnesstheta16 = sPseudotime;
-
-  for ( uint16_t i = 0 ; i < numleds; i++) {
-    hue16 += hueinc16;
-    uint8_t hue8 = hue16 / 256;
-    uint16_t h16_128 = hue16 >> 7;
-    if ( h16_128 & 0x100) {
-      hue8 = 255 - (h16_128 >> 1);
-    } else {
-      hue8 = h16_128 >> 1;
+  uint16_t ms = GET_MILLIS();
+  uint16_t deltams = ms - sColorwavesPlaygroundLastMillis ;
+  sColorwavesPlaygroundLastMillis  = ms;
+  sColorwavesPlaygroundPseudotime += deltams * msmultiplier;
+  sColorwavesPlaygroundHue16 += deltams * beatsin88(sHueBpm * 256, sHueMin, sHueMax);
+  const uint16_t brightnesstheta16Start = sColorwavesPlaygroundPseudotime;
+  BrightnessWave brightness(brightdepth);
+
+  LogicalPixels<ORDER> pixels;
+
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    // hue and brightness phase advance by a fixed step per pixel,
+    // so each range can start part-way through the sequence
+    uint16_t hue16 = hue16Start + first * hueinc16;
+    uint16_t brightnesstheta16 = brightnesstheta16Start + first * brightnessthetainc16;
+    RowBlender<ORDER> blender(pixels, first, 128);
+
+    for (uint16_t i = first; i < last; i++) {
+      hue16 += hueinc16;
+      uint8_t hue8 = hue16 / 256;
+      uint16_t h16_128 = hue16 >> 7;
+      if ( h16_128 & 0x100) {
+        hue8 = 255 - (h16_128 >> 1);
+      } else {
+        hue8 = h16_128 >> 1;
+      }
+
+      brightnesstheta16 += brightnessthetainc16;
+      uint8_t bri8 = brightness(brightnesstheta16);
+
+      uint8_t index = hue8;
+      //index = triwave8( index);
+      index = scale8( index, 240);
+
+      CRGB newcolor = ColorFromPalette( palette, index, bri8);
+
+      blender.push(newcolor);
     }
-
-    brightnesstheta16  += brightnessthetainc16;
-    uint16_t b16 = sin16( brightnesstheta16  ) + 32768;
-
-    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
-    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
-    bri8 += (255 - brightdepth);
-
-    uint8_t index = hue8;
-    //index = triwave8( index);
-    index = scale8( index, 240);
-
-    CRGB newcolor = ColorFromPalette( palette, index, bri8);
-
-    uint16_t pixelnumber = i;
-
-#if IS_FIBONACCI
-    if (useFibonacciOrder) pixelnumber = fibonacciToPhysical[i];
-#else
-    (void)useFibonacciOrder;
-#endif
-
-    pixelnumber = (numleds - 1) - pixelnumber;
-
-    nblend( ledarray[pixelnumber], newcolor, 128);
-  }
+    blender.flush();
+  };
+  forEachPixelRange(NUM_PIXELS, kernel);
 }
 
 void colorWavesPlayground()
 {
-  colorwavesPlayground(leds, NUM_PIXELS, gCurrentPalette, false);
+  colorwavesPlayground<PIXEL_ORDER_REVERSED>(gCurrentPalette);
 }
 
 
 #if IS_FIBONACCI
 void colorWavesPlaygroundFibonacci()
 {
-  colorwavesPlayground(leds, NUM_PIXELS, gCurrentPalette, true);
+  colorwavesPlayground<PIXEL_ORDER_REVERSED_FIBONACCI>(gCurrentPalette);
 }
 #endif
 
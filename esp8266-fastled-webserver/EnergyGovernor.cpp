@@ -0,0 +1,278 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+const __FlashStringHelper* governorStateName(GovernorState state) {
+  switch (state) {
+    case GOVERNOR_STATIC: return F("static");
+    case GOVERNOR_OFF:    return F("off");
+    default:              return F("active");
+  }
+}
+
+#if ENERGY_GOVERNOR
+
+#include <atomic>
+
+static const uint32_t FRAME_MILLIS        = 1000 / FRAMES_PER_SECOND;
+static const uint32_t MAX_FRAME_MILLIS    = 100;  // longest the frame period is stretched to, under load
+static const uint32_t STATIC_FRAME_MILLIS = 100;  // frame interval while static
+static const uint32_t OFF_REFRESH_MILLIS  = 1000; // blank the pixels again this often while off
+static const uint32_t IDLE_POLL_MILLIS    = 20;   // how long to sleep between network / IR polls while idle
+static const uint32_t WAKE_HOLD_MILLIS    = 5000; // keep WiFi and CPU at full speed this long after any input
+static const uint16_t STATIC_AFTER_FRAMES = FRAMES_PER_SECOND; // identical frames before going static
+
+static std::atomic<bool> wakeRequested(false);
+static GovernorState state = GOVERNOR_ACTIVE;
+static RenderParameters lastParameters;
+static uint32_t frameStartMillis = 0;
+static uint32_t frameStartMicros = 0;
+static uint32_t framePeriodMillis = FRAME_MILLIS;
+static uint32_t lastOutputMillis = 0;
+static bool previousFrameActive = false;
+static uint32_t idleSinceMillis = 0;
+static uint32_t wokeAtMillis = 0;
+static uint32_t idleFramesOutput = 0;
+static uint32_t lastFrameHash = 0;
+static uint16_t identicalFrames = 0;
+static uint32_t loadBusyMicros = 0;   // render + show, over the frames since the load was last looked at
+static uint32_t loadPeriodMicros = 0; // ... and the frame periods they took
+static uint16_t loadFrames = 0;
+static GovernorStats stats = { GOVERNOR_ACTIVE, false, 0, 0, 0, 0, FRAME_MILLIS, 0, {} };
+
+static void resetLoad() {
+  loadBusyMicros = loadPeriodMicros = 0;
+  loadFrames = 0;
+}
+
+// The ESP32 clock follows the render load.  FastLED's ESP8266 clockless driver
+// derives the data signal timing from F_CPU at compile time, so the ESP8266
+// stays at its build clock.
+#if defined(ARDUINO_ARCH_ESP32)
+  static const uint32_t CPU_MHZ[] { 80, 160, 240 };
+  static const uint8_t CPU_STEPS = sizeof(CPU_MHZ) / sizeof(CPU_MHZ[0]);
+  static uint8_t cpuStep = CPU_STEPS - 1;
+
+  static void setCpuStep(uint8_t step) {
+    if (step != cpuStep) {
+      setCpuFrequencyMhz(CPU_MHZ[step]);
+      cpuStep = step;
+    }
+  }
+
+  // Steps the clock down when under a third of the frame time is spent
+  // rendering, or up when over four fifths is.  Returns whether it changed.
+  static bool adjustCpuClock(uint32_t loadPercent) {
+    if ((loadPercent < 33) && (cpuStep > 0)) {
+      setCpuStep(cpuStep - 1);
+      return true;
+    }
+    if ((loadPercent > 80) && (cpuStep < CPU_STEPS - 1)) {
+      setCpuStep(cpuStep + 1);
+      return true;
+    }
+    return false;
+  }
+
+  static void setIdleClock(bool idle) {
+    setCpuStep(idle ? 0 : CPU_STEPS - 1);
+    resetLoad();
+  }
+#else
+  static bool adjustCpuClock(uint32_t) { return false; }
+  static void setIdleClock(bool) { resetLoad(); }
+#endif
+
+// Fits the frame period to the render + show time: when that takes longer than
+// the period, frames would follow each other with no sleep, at whatever rate
+// the pattern manages, so the period is stretched to a fifth more than it,
+// which is slept (and sends transfers).  When the load falls under half the
+// period, it shrinks back, never below 1000 / FRAMES_PER_SECOND.
+static void adjustFramePeriod(uint32_t busyMicros) {
+  if ((busyMicros <= framePeriodMillis * 1000) && (busyMicros * 2 >= framePeriodMillis * 1000)) {
+    return;
+  }
+  uint32_t period = (busyMicros * 5 / 4 + 999) / 1000;
+  period = (period < FRAME_MILLIS) ? FRAME_MILLIS : (period > MAX_FRAME_MILLIS) ? MAX_FRAME_MILLIS : period;
+  if (period != framePeriodMillis) {
+    LOG_DEBUG("frame period %lu ms, for %lu us of render + show", (unsigned long)period, (unsigned long)busyMicros);
+    framePeriodMillis = period;
+  }
+}
+
+// Once a second of frames has been measured, adjusts the clock, or, when that
+// is already as fast as it goes, the frame period.
+static void measureLoad(uint32_t busyMicros, uint32_t periodMicros) {
+  loadBusyMicros += busyMicros;
+  loadPeriodMicros += periodMicros;
+  loadFrames++;
+  if (loadPeriodMicros < 1000000) {
+    return;
+  }
+  const uint32_t loadPercent = (uint64_t)loadBusyMicros * 100 / loadPeriodMicros;
+  if (!adjustCpuClock(loadPercent)) {
+    adjustFramePeriod(loadBusyMicros / loadFrames);
+  }
+  resetLoad();
+}
+
+static void enterState(GovernorState next) {
+  if (next == state) {
+    return;
+  }
+  const bool wasIdle = (state != GOVERNOR_ACTIVE);
+  const bool isIdle = (next != GOVERNOR_ACTIVE);
+  if (!wasIdle && isIdle) {
+    idleSinceMillis = millis();
+  } else if (wasIdle && !isIdle) {
+    stats.idleMillis += millis() - idleSinceMillis;
+    identicalFrames = 0;
+  }
+  state = next;
+}
+
+// Modem sleep and the low clock, only once idle and with no recent input,
+// so a burst of requests (e.g., loading the web app) is not slowed down.
+static void updatePowerSaving(uint32_t now) {
+  const bool save = (state != GOVERNOR_ACTIVE) && (now - wokeAtMillis >= WAKE_HOLD_MILLIS);
+  if (save != stats.modemSleep) {
+    WiFi.setSleepMode(save ? WIFI_MODEM_SLEEP : WIFI_NONE_SLEEP);
+    stats.modemSleep = save;
+    setIdleClock(save);
+  }
+}
+
+static void sleepFor(uint32_t ms) {
+  logDrain(); // the log reaches Serial only in time that would otherwise be slept
+  const uint32_t start = millis();
+  #if !RENDER_TASK_ON_SEPARATE_CORE
+    // so do static file transfers, leaving the last millisecond, so the next frame is on time
+    while (transfersPending() && (millis() - start + 1 < ms)) {
+      pumpTransfers((ms - 1 - (millis() - start)) * 1000);
+      delay(1); // lets the network stack take in acks, freeing send buffers
+    }
+  #endif
+  const uint32_t elapsed = millis() - start;
+  if (elapsed < ms) {
+    delay(ms - elapsed);
+  }
+  stats.sleepMillis += ms;
+}
+
+// FNV-1a over the frame, to notice when a pattern keeps drawing the same thing
+static uint32_t frameHash() {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(leds);
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < sizeof(leds); i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+void governorWake() {
+  wakeRequested.store(true, std::memory_order_relaxed);
+}
+
+bool governorBeginFrame(const RenderParameters& parameters) {
+  const bool changed =
+    (parameters.power               != lastParameters.power)               ||
+    (parameters.brightness          != lastParameters.brightness)          ||
+    (parameters.currentPatternIndex != lastParameters.currentPatternIndex) ||
+    (parameters.showClock           != lastParameters.showClock)           ||
+    (parameters.solidColor          != lastParameters.solidColor);
+  lastParameters = parameters;
+  const uint32_t now = millis();
+  if (wakeRequested.exchange(false, std::memory_order_relaxed) || changed) {
+    wokeAtMillis = now;
+    enterState(GOVERNOR_ACTIVE);
+  }
+  updatePowerSaving(now);
+
+  if ((state == GOVERNOR_OFF) && (now - lastOutputMillis < OFF_REFRESH_MILLIS)) {
+    return false;
+  }
+  if ((state == GOVERNOR_STATIC) && (now - lastOutputMillis < STATIC_FRAME_MILLIS)) {
+    return false;
+  }
+  if ((state == GOVERNOR_ACTIVE) && previousFrameActive) {
+    const uint32_t gap = now - frameStartMillis;
+    if (gap > stats.maxFrameGapMillis) {
+      stats.maxFrameGapMillis = gap;
+      LOG_DEBUG("frame gap %lu ms", (unsigned long)gap);
+    }
+  }
+  previousFrameActive = (state == GOVERNOR_ACTIVE);
+  frameStartMillis = now;
+  frameStartMicros = micros();
+  return true;
+}
+
+void governorFrameDrawn() {
+  const uint32_t hash = frameHash();
+  if (hash != lastFrameHash) {
+    lastFrameHash = hash;
+    identicalFrames = 0;
+    enterState(GOVERNOR_ACTIVE);
+  } else if ((identicalFrames < STATIC_AFTER_FRAMES) && (++identicalFrames == STATIC_AFTER_FRAMES)) {
+    enterState(GOVERNOR_STATIC);
+  }
+}
+
+void governorShowAndWait() {
+  stats.showMicros = showAllChannels(leds, stats.outputShowMicros);
+  lastOutputMillis = millis();
+  if (lastParameters.power == 0) {
+    lastFrameHash = 0; // so the first frame after power on never counts as identical
+    enterState(GOVERNOR_OFF);
+  }
+
+  if (state != GOVERNOR_ACTIVE) {
+    idleFramesOutput++;
+    updatePowerSaving(lastOutputMillis);
+    governorWait();
+    return;
+  }
+
+  // sleep for the rest of the frame period, instead of showing the same frame repeatedly until it ends
+  const uint32_t elapsed = lastOutputMillis - frameStartMillis;
+  measureLoad(micros() - frameStartMicros, max(elapsed, framePeriodMillis) * 1000);
+  if (elapsed < framePeriodMillis) {
+    sleepFor(framePeriodMillis - elapsed);
+  } else {
+    yield();
+  }
+}
+
+void governorWait() {
+  sleepFor(IDLE_POLL_MILLIS);
+}
+
+GovernorStats governorStats() {
+  GovernorStats result = stats;
+  result.state = state;
+  result.framePeriodMillis = framePeriodMillis;
+  if (state != GOVERNOR_ACTIVE) {
+    result.idleMillis += millis() - idleSinceMillis;
+  }
+  const uint32_t idleFramePeriods = result.idleMillis / FRAME_MILLIS;
+  result.framesSkipped = (idleFramePeriods > idleFramesOutput) ? (idleFramePeriods - idleFramesOutput) : 0;
+  return result;
+}
+
+#endif // ENERGY_GOVERNOR
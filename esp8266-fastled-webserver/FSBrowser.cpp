@@ -16,16 +16,19 @@ String formatBytes(size_t bytes){
   }
 }
 
-String getContentType(String filename){
-  if(webServer.hasArg("download")) return "application/octet-stream";
-  else if(filename.endsWith(".htm")) return "text/html";
+const char* contentTypeForPath(const String& filename){
+  if(filename.endsWith(".htm")) return "text/html";
   else if(filename.endsWith(".html")) return "text/html";
   else if(filename.endsWith(".css")) return "text/css";
   else if(filename.endsWith(".js")) return "application/javascript";
+  else if(filename.endsWith(".json")) return "application/json";
   else if(filename.endsWith(".png")) return "image/png";
   else if(filename.endsWith(".gif")) return "image/gif";
   else if(filename.endsWith(".jpg")) return "image/jpeg";
   else if(filename.endsWith(".ico")) return "image/x-icon";
+  else if(filename.endsWith(".svg")) return "image/svg+xml";
+  else if(filename.endsWith(".woff")) return "font/woff";
+  else if(filename.endsWith(".woff2")) return "font/woff2";
   else if(filename.endsWith(".xml")) return "text/xml";
   else if(filename.endsWith(".pdf")) return "application/x-pdf";
   else if(filename.endsWith(".zip")) return "application/x-zip";
@@ -33,24 +36,52 @@ String getContentType(String filename){
   return "text/plain";
 }
 
+String getContentType(String filename){
+  if(webServer.hasArg("download")) return "application/octet-stream";
+  return contentTypeForPath(filename);
+}
+
+// Sends the cache validator headers, and answers 304 Not Modified (returning
+// true) when the browser already has this version
+bool sendNotModified(const String& etag){
+  webServer.sendHeader("ETag", etag);
+  webServer.sendHeader("Cache-Control", "max-age=86400");
+  if (webServer.header("If-None-Match") == etag) {
+    webServer.send(304);
+    return true;
+  }
+  return false;
+}
+
+// One lookup in the asset index (then in the embedded web assets, if any);
+// the file system is only touched to send the content
 bool handleFileRead(String path){
-  Serial.println("handleFileRead: " + path);
+  LOG_DEBUG("handleFileRead: %s", path.c_str());
   if (path.endsWith("/")) {
     path += "index.htm";
   }
-  String contentType = getContentType(path);
-  String pathWithGz = path + ".gz";
-  if (MYFS.exists(pathWithGz) || MYFS.exists(path)) {
-    if (MYFS.exists(pathWithGz)) {
-      path = pathWithGz;
-    }
-    File file = MYFS.open(path, "r");
-    (void)webServer.streamFile(file, contentType);
-    file.close();
-    
+  const Asset* asset = findAsset(path);
+  if (asset == nullptr) {
+    return serveWebAsset(path);
+  }
+  if (sendNotModified(assetETag(*asset))) {
     return true;
   }
-  return false;
+
+  const uint32_t start = micros();
+  File file = MYFS.open(asset->gzipped ? (path + ".gz") : path, "r");
+  if (!file) {
+    return false;
+  }
+  const bool download = webServer.hasArg("download");
+  if (asset->gzipped && !download) {
+    webServer.sendHeader("Content-Encoding", "gzip");
+  }
+  webServer.setContentLength(file.size());
+  webServer.send(200, download ? "application/octet-stream" : asset->contentType, "");
+  transferFile(file); // the first chunk now, the rest between frames
+  LOG_DEBUG("%s: %u bytes from LittleFS, first chunk in %lu us", path.c_str(), (unsigned)asset->size, (unsigned long)(micros() - start));
+  return true;
 }
 
 void handleFileUpload(){
@@ -62,7 +93,7 @@ void handleFileUpload(){
     if (!filename.startsWith("/")) {
       filename = "/" + filename;
     }
-    Serial.print("handleFileUpload Name: "); Serial.println(filename);
+    LOG_INFO("handleFileUpload Name: %s", filename.c_str());
     fsUploadFile = MYFS.open(filename, "w");
     filename = String();
   } else if (upload.status == UPLOAD_FILE_WRITE) {
@@ -72,9 +103,11 @@ void handleFileUpload(){
     }
   } else if (upload.status == UPLOAD_FILE_END) {
     if (fsUploadFile) {
+      String filename = fsUploadFile.fullName();
       fsUploadFile.close();
+      refreshAsset(filename);
     }
-    Serial.print("handleFileUpload Size: "); Serial.println(upload.totalSize);
+    LOG_INFO("handleFileUpload Size: %u", (unsigned)upload.totalSize);
   }
 }
 
@@ -84,7 +117,7 @@ void handleFileDelete(){
   }
 
   String path = webServer.arg(0);
-  Serial.println("handleFileDelete: " + path);
+  LOG_INFO("handleFileDelete: %s", path.c_str());
   if (path == "/") {
     return webServer.send(500, "text/plain", "BAD PATH");
   }
@@ -92,6 +125,7 @@ void handleFileDelete(){
     return webServer.send(404, "text/plain", "FileNotFound");
   }
   MYFS.remove(path);
+  refreshAsset(path);
   webServer.send(200, "text/plain", "");
   path = String();
 }
@@ -101,7 +135,7 @@ void handleFileCreate(){
     return webServer.send(500, "text/plain", "BAD ARGS");
   }
   String path = webServer.arg(0);
-  Serial.println("handleFileCreate: " + path);
+  LOG_INFO("handleFileCreate: %s", path.c_str());
   if (path == "/") {
     return webServer.send(500, "text/plain", "BAD PATH");
   }
@@ -111,6 +145,7 @@ void handleFileCreate(){
   File file = MYFS.open(path, "w");
   if (file) {
     file.close();
+    refreshAsset(path);
   } else {
     return webServer.send(500, "text/plain", "CREATE FAILED");
   }
@@ -125,7 +160,7 @@ void handleFileList() {
   }
   
   String path = webServer.arg("dir");
-  Serial.println("handleFileList: " + path);
+  LOG_DEBUG("handleFileList: %s", path.c_str());
   Dir dir = MYFS.openDir(path);
   path = String();
 
@@ -20,9 +20,12 @@
 
 #if IS_FIBONACCI
 
+// stars move along the spiral, so index pixels in Fibonacci order
+typedef LogicalPixels<PIXEL_ORDER_FIBONACCI> SpiralPixels;
+
 // Fibonacci Stars pattern by Jason Coon
 // Draws shooting stars radiating outward from the center, along Fibonacci spiral lines.
-void fibonacciStarsWithOffset(uint16_t stars[], uint8_t starCount, uint8_t offset = 21, bool setup = false, bool move = false)
+void fibonacciStarsWithOffset(const SpiralPixels& pixels, uint16_t stars[], uint8_t starCount, uint8_t offset = 21, bool setup = false, bool move = false)
 {
   // use a number from the Fibonacci sequence for offset to follow a spiral out from the center
 
@@ -34,10 +37,8 @@ void fibonacciStarsWithOffset(uint16_t stars[], uint8_t starCount, uint8_t offse
       stars[i] = random8(offset - 1);
     }
 
-    uint16_t index = fibonacciToPhysical[stars[i]];
-
     // draw the star
-    leds[index] = ColorFromPalette(gCurrentPalette, stars[i] - gHue); // i * (240 / starCount)
+    pixels[stars[i]] = ColorFromPalette(gCurrentPalette, stars[i] - gHue); // i * (240 / starCount)
   }
 
   // move the stars
@@ -52,38 +53,38 @@ void fibonacciStarsWithOffset(uint16_t stars[], uint8_t starCount, uint8_t offse
 
 const uint8_t starCount = NUM_PIXELS >= 256 ? 4 : 2;
 
-void fibonacciStars8(bool setup = false, bool move = false)
+void fibonacciStars8(const SpiralPixels& pixels, bool setup = false, bool move = false)
 {
   static uint16_t stars[starCount];
-  fibonacciStarsWithOffset(stars, starCount, 8, setup, move);
+  fibonacciStarsWithOffset(pixels, stars, starCount, 8, setup, move);
 }
 
-void fibonacciStars13(bool setup = false, bool move = false)
+void fibonacciStars13(const SpiralPixels& pixels, bool setup = false, bool move = false)
 {
   static uint16_t stars[starCount];
-  fibonacciStarsWithOffset(stars, starCount, 13, setup, move);
+  fibonacciStarsWithOffset(pixels, stars, starCount, 13, setup, move);
 }
 
-void fibonacciStars21(bool setup = false, bool move = false)
+void fibonacciStars21(const SpiralPixels& pixels, bool setup = false, bool move = false)
 {
   static uint16_t stars[starCount];
-  fibonacciStarsWithOffset(stars, starCount, 21, setup, move);
+  fibonacciStarsWithOffset(pixels, stars, starCount, 21, setup, move);
 }
 
-void fibonacciStars34(bool setup = false, bool move = false)
+void fibonacciStars34(const SpiralPixels& pixels, bool setup = false, bool move = false)
 {
   static uint16_t stars[starCount];
-  fibonacciStarsWithOffset(stars, starCount, 34, setup, move);
+  fibonacciStarsWithOffset(pixels, stars, starCount, 34, setup, move);
 }
 
-void fibonacciStars55(bool setup = false, bool move = false) {
+void fibonacciStars55(const SpiralPixels& pixels, bool setup = false, bool move = false) {
   static uint16_t stars[starCount];
-  fibonacciStarsWithOffset(stars, starCount, 55, setup, move);
+  fibonacciStarsWithOffset(pixels, stars, starCount, 55, setup, move);
 }
 
-void fibonacciStars89(bool setup = false, bool move = false) {
+void fibonacciStars89(const SpiralPixels& pixels, bool setup = false, bool move = false) {
   static uint16_t stars[starCount];
-  fibonacciStarsWithOffset(stars, starCount, 89, setup, move);
+  fibonacciStarsWithOffset(pixels, stars, starCount, 89, setup, move);
 }
 
 // called from Arduino loop
@@ -91,7 +92,8 @@ void fibonacciStars()
 {
   bool move = false;
   static bool setup = true;
-  fadeToBlackBy(leds, NUM_PIXELS, 8);
+  SpiralPixels pixels;
+  fadeToBlackByPacked(pixels.data(), NUM_PIXELS, 8);
 
   EVERY_N_MILLIS(60)
   {
@@ -99,16 +101,16 @@ void fibonacciStars()
   }
 
   if (NUM_PIXELS >= 128) {
-    fibonacciStars8(setup, move);
-    fibonacciStars13(setup, move);
+    fibonacciStars8(pixels, setup, move);
+    fibonacciStars13(pixels, setup, move);
   } else if (NUM_PIXELS >= 256) {
-    fibonacciStars13(setup, move);
-    fibonacciStars21(setup, move);
-    fibonacciStars34(setup, move);
+    fibonacciStars13(pixels, setup, move);
+    fibonacciStars21(pixels, setup, move);
+    fibonacciStars34(pixels, setup, move);
   } else if (NUM_PIXELS >= 1024) {
-    fibonacciStars34(setup, move);
-    fibonacciStars55(setup, move);
-    fibonacciStars89(setup, move);
+    fibonacciStars34(pixels, setup, move);
+    fibonacciStars55(pixels, setup, move);
+    fibonacciStars89(pixels, setup, move);
   }
   setup = false;
 }
@@ -513,9 +513,8 @@ uint8_t setUtcOffsetIndex(uint8_t value) {
   // convert to seconds
   utcOffsetInSeconds = tmp * 60;
 
-  Serial.print(F("utcOffsetIndex: ")); Serial.println(utcOffsetIndex);
-  Serial.print(F("utcOffsetInSeconds: ")); Serial.println(utcOffsetInSeconds);
-  timeClient.setTimeOffset(utcOffsetInSeconds);
+  LOG_INFO("utcOffsetIndex: %u, utcOffsetInSeconds: %d", utcOffsetIndex, utcOffsetInSeconds);
+  ntpClock.setTimeOffset(utcOffsetInSeconds);
   writeAndCommitSettings();
   return utcOffsetIndex;
 }
@@ -537,6 +536,7 @@ String getFieldValue(String name) {
   return getFieldValue(name, fields);
 }
 String setFieldValue(String name, String value) {
+  governorWake(); // a setting may have changed
   return setFieldValue(name, value, fields);
 }
 
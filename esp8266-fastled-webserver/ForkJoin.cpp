@@ -0,0 +1,70 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+#if PARALLEL_PIXEL_KERNELS
+
+// Below this many pixels, waking the other core costs more than it saves.
+static const uint16_t minimumPixelsToSplit = 64;
+
+static TaskHandle_t forkJoinWorkerTask = nullptr;
+static TaskHandle_t forkJoinCallerTask = nullptr;
+
+// The job currently handed to the worker.  Written only by the caller,
+// and only while the worker is idle (waiting for a notification).
+static PixelRangeFunction jobFunction = nullptr;
+static void* jobContext = nullptr;
+static uint16_t jobFirst = 0;
+static uint16_t jobLast = 0;
+
+static void forkJoinWorker(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    jobFunction(jobContext, jobFirst, jobLast);
+    xTaskNotifyGive(forkJoinCallerTask);
+  }
+}
+
+void startForkJoinWorker() {
+  if (forkJoinWorkerTask != nullptr) return;
+  // Higher priority than networkTask(), so half a frame is never
+  // left waiting behind a slow HTTP request on that core.
+  xTaskCreatePinnedToCore(forkJoinWorker, "pixels", 4096, nullptr, 2, &forkJoinWorkerTask, NETWORK_TASK_CORE);
+}
+
+void forkJoinPixelRanges(PixelRangeFunction function, void* context, uint16_t count) {
+  if ((forkJoinWorkerTask == nullptr) || (count < minimumPixelsToSplit)) {
+    function(context, 0, count);
+    return;
+  }
+
+  const uint16_t split = count / 2;
+
+  jobFunction = function;
+  jobContext = context;
+  jobFirst = split;
+  jobLast = count;
+  forkJoinCallerTask = xTaskGetCurrentTaskHandle();
+
+  xTaskNotifyGive(forkJoinWorkerTask);      // fork: upper range on the other core
+  function(context, 0, split);              // lower range on this core
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // join
+}
+
+#endif // PARALLEL_PIXEL_KERNELS
@@ -0,0 +1,120 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+// based on FastLED example Fire2012WithPalette: https://github.com/FastLED/FastLED/blob/master/examples/Fire2012WithPalette/Fire2012WithPalette.ino
+//
+// The simulation is the same, arranged to touch each cell fewer times per frame:
+// * cooling works on four cells per 32-bit word, using one random number per word
+// * diffusion divides by three with a multiply-shift, and maps each cell to its color
+//   as soon as its heat is final (only the bottom cells can still receive a spark)
+
+static const uint16_t heatCellCount = (NUM_PIXELS + 3) & ~3; // whole words
+static const uint8_t  heatSparkCells = 7; // sparks are only added to cells [0 .. heatSparkCells)
+
+// A seed from the hardware random number generator, so each boot's flames differ
+static uint32_t heatRandomSeed() {
+#if defined(ESP32)
+  const uint32_t seed = esp_random();
+#else
+  const uint32_t seed = random(0x7FFFFFFF); // RANDOM_REG32 on ESP8266, as the sketch never calls randomSeed()
+#endif
+  return (seed != 0) ? seed : 0x2545F491;
+}
+
+// xorshift32: four random bytes per call.  The state is never zero once seeded,
+// so zero means not seeded yet.
+static uint32_t heatRandomState = 0;
+static inline uint32_t heatRandom32() {
+  uint32_t x = heatRandomState;
+  if (x == 0) {
+    x = heatRandomSeed();
+  }
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return heatRandomState = x;
+}
+
+// For each of the four bytes: qsub8(heat, random8(0, limit)),
+// where random8(0, limit) == (random * limit) >> 8
+static inline uint32_t coolHeatCells(uint32_t heat, uint32_t random, uint8_t limit) {
+  const uint32_t EVEN_BYTES = 0x00FF00FF;
+  const uint32_t GUARD_BITS = 0x01000100; // bit 8 of each 16-bit lane
+  const uint32_t evenAmount = ((((random     ) & EVEN_BYTES) * limit) >> 8) & EVEN_BYTES;
+  const uint32_t oddAmount  = ((((random >> 8) & EVEN_BYTES) * limit) >> 8) & EVEN_BYTES;
+  // the guard bit survives the subtraction only when it did not underflow
+  uint32_t even = (((heat     ) & EVEN_BYTES) | GUARD_BITS) - evenAmount;
+  uint32_t odd  = (((heat >> 8) & EVEN_BYTES) | GUARD_BITS) - oddAmount;
+  even &= ((even >> 8) & 0x00010001) * 0xFF;
+  odd  &= ((odd  >> 8) & 0x00010001) * 0xFF;
+  return even | (odd << 8);
+}
+
+void heatMap(const CRGBPalette16& palette, bool up)
+{
+  // Modify random number generator seed; we use a lot of it.  (Note: this is still deterministic)
+  random16_add_entropy(random(256));
+
+  // Array of temperature readings at each simulation cell
+  alignas(4) static byte heat[heatCellCount];
+
+  auto mapToColor = [&](uint16_t j) {
+    // Scale the heat value from 0-255 down to 0-240
+    // for best results with color palettes.
+    CRGB color = ColorFromPalette(palette, scale8(heat[j], 190));
+
+    if (up) {
+      leds[j] = color;
+    }
+    else {
+      leds[(NUM_PIXELS - 1) - j] = color;
+    }
+  };
+
+  // Step 1.  Cool down every cell a little
+  const uint8_t coolingLimit = ((cooling * 10) / NUM_PIXELS) + 2;
+  packed_word_t* heatWords = reinterpret_cast<packed_word_t*>(heat);
+  for ( uint16_t w = 0; w < (heatCellCount / 4); w++) {
+    heatWords[w] = coolHeatCells(heatWords[w], heatRandom32(), coolingLimit);
+  }
+
+  // Step 2.  Heat from each cell drifts 'up' and diffuses a little
+  //          (cells below k still hold their previous values, so this can run top-down in place)
+  for ( uint16_t k = NUM_PIXELS - 1; k >= 2; k--) {
+    // (sum * 683) >> 11 == sum / 3, for all sums up to 3 * 255
+    heat[k] = ((heat[k - 1] + heat[k - 2] + heat[k - 2]) * 683) >> 11;
+
+    // Step 4a.  Map from heat cells to LED colors, for cells that no spark can reach
+    if (k >= heatSparkCells) {
+      mapToColor(k);
+    }
+  }
+
+  // Step 3.  Randomly ignite new 'sparks' of heat near the bottom
+  if ( random8() < sparking ) {
+    int y = random8(heatSparkCells);
+    heat[y] = qadd8( heat[y], random8(160, 255) );
+  }
+
+  // Step 4b.  Map the remaining heat cells to LED colors
+  for ( uint16_t j = 0; j < heatSparkCells; j++) {
+    mapToColor(j);
+  }
+}
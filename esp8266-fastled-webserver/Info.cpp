@@ -33,7 +33,9 @@ String WiFi_SSID(bool persistent) {
 //
 // Any decent compiler will throw away this unreferenced data during optimization.
 //
-// This pretty-printed version takes 1031 characters, minified version takes 890 characters.
+// This pretty-printed version takes 1031 characters, minified version takes 890 characters,
+// plus ~50 characters for the show timing, 11 characters per additional output channel,
+// and ~185 characters for the energy governor.
 static const char MaximumLengthJson[] { R"RAW_STRING(
 {
   "millis" : 4294967295,
@@ -63,14 +65,24 @@ static const char MaximumLengthJson[] { R"RAW_STRING(
   "softAPSSID" : "0123456789ABCDEF0123456789ABCDEF",
   "softAPIP" : "255.255.255.255",
   "BSSID" : "00:11:22:33:44:55",
-  "softAPMacAddress" : "00:11:22:33:44:55"
+  "softAPMacAddress" : "00:11:22:33:44:55",
+  "showMicros" : 4294967295,
+  "channelShowMicros" : [ 4294967295 ],
+  "powerState" : "static",
+  "modemSleep" : false,
+  "idleMillis" : 4294967295,
+  "sleepMillis" : 4294967295,
+  "framesSkipped" : 4294967295,
+  "maxFrameGapMillis" : 4294967295,
+  "framePeriodMillis" : 4294967295
 }
 )RAW_STRING" };
 static const char MinifiedMaximumLengthJson[] { R"RAW_STRING(
-{"millis":2147483640,"vcc":65535,"wiFiChipId":"FF22CC44","flashChipId":"FF22CC44","flashChipSize":1073741823,"flashChipRealSize":1073741823,"sdkVersion":"2.2.2-SOME_RANDOM_STRING_LENGTH","coreVersion":"2.3.4-SOME_RANDOM_STRING","bootVersion":255,"cpuFreqMHz":255,"freeHeap":1073741823,"sketchSize":1073741823,"freeSketchSpace":1073741823,"resetReason":"Software/System restart","isConnected":false,"wiFiSsidDefault":"0123456789ABCDEF0123456789ABCDEF","wiFiSSID":"0123456789ABCDEF0123456789ABCDEF","localIP":"255.255.255.255","gatewayIP":"255.255.255.255","subnetMask":"255.255.255.255","dnsIP":"255.255.255.255","hostname":"0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF","macAddress":"00:11:22:33:44:55","autoConnect":false,"softAPSSID":"0123456789ABCDEF0123456789ABCDEF","softAPIP":"255.255.255.255","BSSID":"00:11:22:33:44:55","softAPMacAddress":"00:11:22:33:44:55"}
+{"millis":2147483640,"vcc":65535,"wiFiChipId":"FF22CC44","flashChipId":"FF22CC44","flashChipSize":1073741823,"flashChipRealSize":1073741823,"sdkVersion":"2.2.2-SOME_RANDOM_STRING_LENGTH","coreVersion":"2.3.4-SOME_RANDOM_STRING","bootVersion":255,"cpuFreqMHz":255,"freeHeap":1073741823,"sketchSize":1073741823,"freeSketchSpace":1073741823,"resetReason":"Software/System restart","isConnected":false,"wiFiSsidDefault":"0123456789ABCDEF0123456789ABCDEF","wiFiSSID":"0123456789ABCDEF0123456789ABCDEF","localIP":"255.255.255.255","gatewayIP":"255.255.255.255","subnetMask":"255.255.255.255","dnsIP":"255.255.255.255","hostname":"0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF","macAddress":"00:11:22:33:44:55","autoConnect":false,"softAPSSID":"0123456789ABCDEF0123456789ABCDEF","softAPIP":"255.255.255.255","BSSID":"00:11:22:33:44:55","softAPMacAddress":"00:11:22:33:44:55","showMicros":1999999999,"channelShowMicros":[1999999999],"powerState":"static","modemSleep":false,"idleMillis":1999999999,"sleepMillis":1999999999,"framesSkipped":1999999999,"maxFrameGapMillis":1999999999,"framePeriodMillis":1999999999}
 )RAW_STRING" };
 #endif
-static const size_t infoJsonDocumentAllocationSize = 1024;
+// Additional room for "showMicros" and "channelShowMicros" (up to 16 channels), and the energy governor
+static const size_t infoJsonDocumentAllocationSize = 1024 + 512 + 192;
 
 String getInfoJson()
 {
@@ -103,6 +115,22 @@ String getInfoJson()
   jsonDoc[F("softAPIP")]           = WiFi.softAPIP().toString();        // IPv4
   jsonDoc[F("BSSID")]              = WiFi.BSSIDstr();                   // macAddress
   jsonDoc[F("softAPMacAddress")]   = WiFi.softAPmacAddress();           // macAddress
+  const GovernorStats governor = governorStats();
+  jsonDoc[F("showMicros")]         = governor.showMicros;               // uint32_t; the last frame's output, all channels
+  if (outputCount == PARALLEL_OUTPUT_CHANNELS) {
+    // each channel is output on its own (see showAllChannels()), so it has its own time
+    JsonArray channels = jsonDoc.createNestedArray(F("channelShowMicros"));
+    for (uint8_t i = 0; i < outputCount; i++) {
+      channels.add(governor.outputShowMicros[i]);                       // uint32_t
+    }
+  }
+  jsonDoc[F("powerState")]         = governorStateName(governor.state); // "active", "static" or "off"
+  jsonDoc[F("modemSleep")]         = governor.modemSleep;               // boolean
+  jsonDoc[F("idleMillis")]         = governor.idleMillis;               // uint32_t; time static or off
+  jsonDoc[F("sleepMillis")]        = governor.sleepMillis;              // uint32_t; time sleeping between frames
+  jsonDoc[F("framesSkipped")]      = governor.framesSkipped;            // uint32_t; frames not drawn while idle
+  jsonDoc[F("maxFrameGapMillis")]  = governor.maxFrameGapMillis;        // uint32_t; longest stall of the animation
+  jsonDoc[F("framePeriodMillis")]  = governor.framePeriodMillis;        // uint32_t; stretched while patterns overrun the frame rate
 
   // what to do if overflow the ArduinoJSON buffer?
   if (jsonDoc.overflowed()) {
@@ -112,10 +140,10 @@ String getInfoJson()
 
   // convert to String
   String result;
-  // avoid heap fragmentation by pre-allocating 1023 bytes for result string.
+  // avoid heap fragmentation by pre-allocating 1151 bytes for result string.
   // As of 2021-11-21, maximum 890 chars needed for minified result.
   // As of 2021-11-21, maximum 1031 characters needed for prettified result.
-  result.reserve(1023); 
+  result.reserve(1151); 
   serializeJson(jsonDoc, result);
   return result;
 }
@@ -0,0 +1,130 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+#if RUNTIME_LAYOUT_FILE
+
+// The sections of the loaded layout that are in use, laid out as in the file
+// (so each table starts 4-byte aligned, as MapTableStream requires)
+static uint8_t* layoutTables = nullptr;
+
+static size_t paddedSize(size_t bytes) {
+  return (bytes + 3u) & ~static_cast<size_t>(3u);
+}
+
+#if IS_FIBONACCI
+// Each table must be a permutation, and the inverse of the other; otherwise
+// patterns would write outside of leds[].
+static bool validFibonacciTables(const fibonacci_index_t* toFibonacci, const fibonacci_index_t* toPhysical) {
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    if ((toFibonacci[i] >= NUM_PIXELS) || (toPhysical[toFibonacci[i]] != i)) {
+      return false;
+    }
+  }
+  return true;
+}
+#endif
+
+// returns nullptr on success, otherwise why the file was rejected
+static const char* readLayoutFile(File& file, uint8_t*& tables) {
+  LayoutFileHeader header;
+  if (file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header)) {
+    return "truncated header";
+  }
+  if (memcmp(header.magic, LAYOUT_FILE_MAGIC, sizeof(header.magic)) != 0) {
+    return "not a layout file";
+  }
+  if (header.version != LAYOUT_FILE_VERSION) {
+    return "unsupported version";
+  }
+  if (header.pixelCount != NUM_PIXELS) {
+    return "pixel count does not match NUM_PIXELS";
+  }
+  if (IS_FIBONACCI && !(header.flags & LAYOUT_HAS_FIBONACCI)) {
+    return "no Fibonacci order, which this product's patterns require";
+  }
+
+  const size_t indexSize = (NUM_PIXELS > 256) ? sizeof(uint16_t) : sizeof(uint8_t);
+  const size_t coordinateBytes = 4 * paddedSize(NUM_PIXELS);
+  const size_t fibonacciBytes  = (header.flags & LAYOUT_HAS_FIBONACCI) ? 2 * paddedSize(NUM_PIXELS * indexSize) : 0;
+  const size_t neighborBytes   = (header.flags & LAYOUT_HAS_NEIGHBORS) ? paddedSize(NUM_PIXELS * header.neighborsPerPixel * sizeof(uint16_t)) : 0;
+  const size_t ringBytes       = (header.flags & LAYOUT_HAS_RINGS)     ? paddedSize(header.ringCount * 2 * sizeof(uint16_t)) : 0;
+  if (file.size() != sizeof(header) + coordinateBytes + fibonacciBytes + neighborBytes + ringBytes) {
+    return "file size does not match header";
+  }
+
+  const size_t usedBytes = coordinateBytes + (IS_FIBONACCI ? fibonacciBytes : 0);
+  tables = static_cast<uint8_t*>(malloc(usedBytes)); // at least 4-byte aligned
+  if (tables == nullptr) {
+    return "not enough memory";
+  }
+  if (file.read(tables, usedBytes) != usedBytes) {
+    return "read failed";
+  }
+#if IS_FIBONACCI
+  const fibonacci_index_t* toFibonacci = reinterpret_cast<const fibonacci_index_t*>(tables + coordinateBytes);
+  const fibonacci_index_t* toPhysical  = reinterpret_cast<const fibonacci_index_t*>(tables + coordinateBytes + fibonacciBytes / 2);
+  if (!validFibonacciTables(toFibonacci, toPhysical)) {
+    return "Fibonacci tables are not inverse permutations";
+  }
+#endif
+  return nullptr;
+}
+
+bool loadLayoutFile(const char* path) {
+  if (layoutTables != nullptr) {
+    return true;
+  }
+  if (!MYFS.exists(path)) {
+    return false;
+  }
+  File file = MYFS.open(path, "r");
+  if (!file) {
+    return false;
+  }
+
+  uint8_t* tables = nullptr;
+  const char* error = readLayoutFile(file, tables);
+  file.close();
+  if (error != nullptr) {
+    free(tables);
+    LOG_WARN("Layout file %s ignored: %s", path, error);
+    return false;
+  }
+
+  const size_t tableSize = paddedSize(NUM_PIXELS);
+  coordsX.setData(tables);
+  coordsY.setData(tables + tableSize);
+  angles.setData(tables + 2 * tableSize);
+  radiusProxy.setData(tables + 3 * tableSize);
+#if IS_FIBONACCI
+  const size_t indexTableSize = paddedSize(NUM_PIXELS * sizeof(fibonacci_index_t));
+  physicalToFibonacci.setData(reinterpret_cast<const fibonacci_index_t*>(tables + 4 * tableSize));
+  fibonacciToPhysical.setData(reinterpret_cast<const fibonacci_index_t*>(tables + 4 * tableSize + indexTableSize));
+#endif
+  layoutTables = tables;
+  LOG_INFO("Layout file %s loaded", path);
+  return true;
+}
+
+bool layoutFileLoaded() {
+  return layoutTables != nullptr;
+}
+
+#endif // RUNTIME_LAYOUT_FILE
@@ -0,0 +1,112 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+#if (LOG_LEVEL > LOG_LEVEL_NONE)
+
+// Positions count every byte ever logged; the buffer holds the last
+// LOG_BUFFER_SIZE of them, at position % LOG_BUFFER_SIZE.
+static char logBuffer[LOG_BUFFER_SIZE];
+static uint32_t logHead = 0;   // position of the next byte to be logged
+static uint32_t serialTail = 0; // position of the next byte to be written to Serial
+
+#if defined(ARDUINO_ARCH_ESP32)
+  static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
+  #define LOG_LOCK()   portENTER_CRITICAL(&logMux)
+  #define LOG_UNLOCK() portEXIT_CRITICAL(&logMux)
+#else
+  #define LOG_LOCK()
+  #define LOG_UNLOCK()
+#endif
+
+static uint32_t oldestPosition() {
+  return (logHead > LOG_BUFFER_SIZE) ? (logHead - LOG_BUFFER_SIZE) : 0;
+}
+
+// After the buffer has wrapped, the oldest line is partly overwritten; skip it
+static uint32_t oldestWholeLine() {
+  const uint32_t oldest = oldestPosition();
+  if (oldest == 0) {
+    return 0;
+  }
+  uint32_t position = oldest;
+  while ((position < logHead) && (logBuffer[position % LOG_BUFFER_SIZE] != '\n')) {
+    position++;
+  }
+  return min(position + 1, logHead);
+}
+
+void logPrintf(uint8_t level, PGM_P format, ...) {
+  static const char levelNames[] = "?EWID";
+  char message[LOG_MESSAGE_MAX];
+  int length = snprintf(message, sizeof(message), "%lu %c ", (unsigned long)millis(), levelNames[level < 5 ? level : 0]);
+  va_list args;
+  va_start(args, format);
+  const int formatted = vsnprintf_P(message + length, sizeof(message) - length, format, args);
+  va_end(args);
+  length = min(length + max(formatted, 0), (int)sizeof(message) - 1);
+  if (message[length - 1] == '\n') {
+    length--; // every line gets exactly one
+  }
+
+  LOG_LOCK();
+  for (int i = 0; i < length; i++) {
+    logBuffer[logHead++ % LOG_BUFFER_SIZE] = message[i];
+  }
+  logBuffer[logHead++ % LOG_BUFFER_SIZE] = '\n';
+  LOG_UNLOCK();
+}
+
+void logDrain() {
+  size_t budget = LOG_DRAIN_MAX_BYTES;
+  while (budget > 0) {
+    LOG_LOCK();
+    if (serialTail < oldestPosition()) {
+      serialTail = oldestWholeLine(); // skip what was overwritten
+    }
+    const uint32_t offset = serialTail % LOG_BUFFER_SIZE;
+    // contiguous bytes only; the wrapped part goes on the next pass
+    size_t count = min<uint32_t>(logHead - serialTail, LOG_BUFFER_SIZE - offset);
+    LOG_UNLOCK();
+
+    count = min<size_t>(min(count, budget), Serial.availableForWrite());
+    if (count == 0) {
+      return;
+    }
+    // the writer may overwrite these bytes meanwhile; at worst a garbled serial line
+    Serial.write(logBuffer + offset, count);
+    serialTail += count;
+    budget -= count;
+  }
+}
+
+uint32_t logCopy(uint32_t since, String& out) {
+  LOG_LOCK();
+  const uint32_t head = logHead;
+  uint32_t position = ((since < oldestPosition()) || (since > head)) ? oldestWholeLine() : since;
+  LOG_UNLOCK();
+
+  out.reserve(out.length() + (head - position));
+  for (; position < head; position++) {
+    out += logBuffer[position % LOG_BUFFER_SIZE];
+  }
+  return head;
+}
+
+#endif // LOG_LEVEL > LOG_LEVEL_NONE
@@ -18,45 +18,6 @@
 
 #include "common.h"
 
-#if 0 && defined(PRODUCT_1628_RINGS)
-  // NOTE: these are entirely unused, and thus commented out entirely.
-  //       however, they are retained in case they would be useful in future.
-
-  // Polar coordinate mapping code for FastLED by Adam Haile, Maniacal Labs:
-  // http://maniacallabs.com/2015/05/04/review-code-adafruit-dotstar-disk/
-  // https://gist.github.com/adammhaile/a769f3ff87ff61f22ace
-
-  const uint8_t ringCount { 20 };           // Total Number of Rings. AdaFruit Disk has 10
-  const uint8_t lastRing { ringCount - 1 }; // for convenience
-
-  //Map rings on disk to indicies.
-  //Each represents one of the concentric rings.
-  //TODO: change to structure with min/max (inclusive), to clarify meaning of indices
-  const uint16_t rings[ringCount][2] {
-    // { first pixel of the ring, last pixel of the ring } // INCLUSIVE indices
-    {    0,    3 },
-    {    4,   15 },
-    {   16,   36 },
-    {   37,   65 },
-    {   66,  102 },
-    {  103,  147 },
-    {  148,  200 },
-    {  201,  262 },
-    {  263,  332 },
-    {  333,  410 },
-    {  411,  496 },
-    {  497,  590 },
-    {  591,  692 },
-    {  693,  802 },
-    {  803,  920 },
-    {  921, 1045 },
-    { 1046, 1180 },
-    { 1181, 1322 },
-    { 1323, 1467 },
-    { 1468, 1627 },
-  };
-#endif
-
 // drawNoise() function uses coordsX / coordsY
 #if HAS_COORDINATE_MAP
 
@@ -127,15 +88,20 @@ CRGB noiseXYZ(CRGBPalette16 palette, uint8_t hueReduce, int x, int y, int z)
 
 void drawNoise(CRGBPalette16 palette, uint8_t hueReduce = 0)
 {
-  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
-    uint8_t x = coordsX[i];
-    uint8_t y = coordsY[i];
-
-    int xoffset = noisescale * x;
-    int yoffset = noisescale * y;
-
-    leds[i] = noiseXYZ(palette, hueReduce, x + xoffset + noisex, y + yoffset + noisey, noisez);
-  }
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    MapTableStream<uint8_t> xs(coordsX, first);
+    MapTableStream<uint8_t> ys(coordsY, first);
+    for (uint16_t i = first; i < last; i++) {
+      uint8_t x = xs.next();
+      uint8_t y = ys.next();
+
+      int xoffset = noisescale * x;
+      int yoffset = noisescale * y;
+
+      leds[i] = noiseXYZ(palette, hueReduce, x + xoffset + noisex, y + yoffset + noisey, noisez);
+    }
+  };
+  forEachPixelRange(NUM_PIXELS, kernel);
 
   noisex += noisespeedx;
   noisey += noisespeedy;
@@ -262,14 +228,19 @@ void paletteNoise() {
 // drawPolarNoise() uses angles[] and radiusProxy[]
 void drawPolarNoise(CRGBPalette16 palette, uint8_t hueReduce = 0)
 {
-  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
-    uint8_t x = angles[i];
-    uint8_t y = radiusProxy[i] / 2u; // divide by 2 to change range of values from [0..255] to [0..127]
-
-    int xoffset = noisescale * x;
-    int yoffset = noisescale * y;
-    leds[i] = noiseXYZ(palette, hueReduce, x + xoffset + noisex, y + yoffset + noisey, noisez);
-  }
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    MapTableStream<uint8_t> pixelAngles(angles, first);
+    MapTableStream<uint8_t> radii(radiusProxy, first);
+    for (uint16_t i = first; i < last; i++) {
+      uint8_t x = pixelAngles.next();
+      uint8_t y = radii.next() / 2u; // divide by 2 to change range of values from [0..255] to [0..127]
+
+      int xoffset = noisescale * x;
+      int yoffset = noisescale * y;
+      leds[i] = noiseXYZ(palette, hueReduce, x + xoffset + noisex, y + yoffset + noisey, noisez);
+    }
+  };
+  forEachPixelRange(NUM_PIXELS, kernel);
   noisex += noisespeedx;
   noisey += noisespeedy;
   noisez += noisespeedz;
@@ -0,0 +1,243 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+NtpClock ntpClock;
+
+static const uint32_t SLEW_MILLIS           = 60000; // small corrections are spread over this long
+static const int32_t  STEP_THRESHOLD_MILLIS = 1000;  // larger corrections are applied at once
+
+// UTC, in milliseconds since 1970, at millis() == now
+static uint64_t utcEpochMillis(const NtpClock::TimeBase& base, uint32_t now) {
+  const uint32_t elapsed = now - base.atMillis;
+  const int32_t slewed = (elapsed >= SLEW_MILLIS) ? base.slewMillis : (int32_t)((int64_t)base.slewMillis * elapsed / SLEW_MILLIS);
+  return base.epochMillis + elapsed + slewed;
+}
+
+void NtpClock::setTimeOffset(int32_t seconds) {
+  TimeBase base = _published;
+  base.offsetSeconds = seconds;
+  publish(base);
+}
+
+void NtpClock::publish(const TimeBase& base) {
+  _published = base;
+  _snapshot.publish(base);
+}
+
+bool NtpClock::isTimeSet() {
+  return _snapshot.acquire().valid;
+}
+
+uint64_t NtpClock::localEpochMillis() {
+  const TimeBase& base = _snapshot.acquire();
+  return utcEpochMillis(base, millis()) + (int64_t)base.offsetSeconds * 1000;
+}
+
+uint32_t NtpClock::getEpochTime() {
+  return localEpochMillis() / 1000;
+}
+
+uint8_t NtpClock::getHours() {
+  return hoursOf(getEpochTime());
+}
+
+uint8_t NtpClock::getMinutes() {
+  return minutesOf(getEpochTime());
+}
+
+uint8_t NtpClock::getSeconds() {
+  return secondsOf(getEpochTime());
+}
+
+#if ENABLE_NTP
+
+#include <atomic>
+#include <lwip/dns.h>
+
+static const uint16_t NTP_PORT               = 123;
+static const uint8_t  NTP_PACKET_SIZE        = 48;
+static const uint32_t SEVENTY_YEARS          = 2208988800UL; // 1900 (NTP epoch) to 1970 (Unix epoch)
+static const uint32_t RESOLVE_TIMEOUT_MILLIS = 5000;
+static const uint32_t REPLY_TIMEOUT_MILLIS   = 2000;
+static const uint32_t FIRST_RETRY_MILLIS     = 15000;
+
+static WiFiUDP ntpUDP;
+
+// Written by the lwIP DNS callback, which may run in another task
+enum ResolveState : uint8_t { RESOLVE_PENDING, RESOLVE_DONE, RESOLVE_FAILED };
+static std::atomic<uint8_t> resolveState(RESOLVE_PENDING);
+static std::atomic<uint32_t> serverAddress(0);
+
+static void dnsFound(const char*, const ip_addr_t* address, void*) {
+  if (address != nullptr) {
+    serverAddress.store(ip4_addr_get_u32(ip_2_ip4(address)), std::memory_order_relaxed);
+    resolveState.store(RESOLVE_DONE, std::memory_order_release);
+  } else {
+    resolveState.store(RESOLVE_FAILED, std::memory_order_release);
+  }
+}
+
+static uint32_t readUint32(const uint8_t* bytes) {
+  return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+}
+
+static void writeUint32(uint8_t* bytes, uint32_t value) {
+  bytes[0] = value >> 24;
+  bytes[1] = value >> 16;
+  bytes[2] = value >> 8;
+  bytes[3] = value;
+}
+
+// NTP timestamp (seconds since 1900, 32-bit binary fraction) to milliseconds since 1970
+static uint64_t timestampToEpochMillis(const uint8_t* bytes) {
+  const uint32_t seconds = readUint32(bytes) - SEVENTY_YEARS;
+  const uint32_t fraction = readUint32(bytes + 4);
+  return (uint64_t)seconds * 1000 + (((uint64_t)fraction * 1000) >> 32);
+}
+
+void NtpClock::begin(const char* server) {
+  _server = server;
+  ntpUDP.begin(NTP_PORT);
+}
+
+void NtpClock::update() {
+  if ((_server == nullptr) || (WiFi.status() != WL_CONNECTED)) {
+    _state = IDLE;
+    return;
+  }
+  const uint32_t now = millis();
+  switch (_state) {
+    case IDLE:
+      if ((int32_t)(now - _nextRequestMillis) >= 0) {
+        startRequest(now);
+      }
+      break;
+    case RESOLVING:
+      if (resolveState.load(std::memory_order_acquire) == RESOLVE_DONE) {
+        sendRequest(now);
+      } else if ((resolveState.load(std::memory_order_acquire) == RESOLVE_FAILED) || (now - _stateMillis >= RESOLVE_TIMEOUT_MILLIS)) {
+        LOG_WARN("NTP: could not resolve %s", _server);
+        retryLater(now);
+      }
+      break;
+    case WAITING:
+      receiveReply(now);
+      break;
+  }
+}
+
+void NtpClock::startRequest(uint32_t now) {
+  _state = RESOLVING;
+  _stateMillis = now;
+  resolveState.store(RESOLVE_PENDING, std::memory_order_relaxed);
+  // answers from the cache at once; otherwise dnsFound() is called later
+  ip_addr_t address;
+  const err_t result = dns_gethostbyname(_server, &address, dnsFound, nullptr);
+  if (result == ERR_OK) {
+    dnsFound(_server, &address, nullptr);
+  } else if (result != ERR_INPROGRESS) {
+    dnsFound(_server, nullptr, nullptr);
+  }
+}
+
+void NtpClock::sendRequest(uint32_t now) {
+  // discard late replies to earlier requests
+  while (ntpUDP.parsePacket() > 0) {
+    ntpUDP.flush();
+  }
+
+  uint8_t packet[NTP_PACKET_SIZE] = {};
+  packet[0] = 0b11100011; // no leap second warning, version 4, client mode
+  // the server echoes the transmit timestamp as its originate timestamp
+  _requestNonce = random(0x7FFFFFFF) ^ now;
+  writeUint32(packet + 40, _requestNonce);
+
+  _state = WAITING;
+  _stateMillis = now;
+  if (!ntpUDP.beginPacket(IPAddress(serverAddress.load(std::memory_order_relaxed)), NTP_PORT) ||
+      (ntpUDP.write(packet, NTP_PACKET_SIZE) != NTP_PACKET_SIZE) ||
+      !ntpUDP.endPacket()) {
+    LOG_WARN("NTP: send failed");
+    retryLater(now);
+  }
+}
+
+void NtpClock::receiveReply(uint32_t now) {
+  if (ntpUDP.parsePacket() < NTP_PACKET_SIZE) {
+    if (now - _stateMillis >= REPLY_TIMEOUT_MILLIS) {
+      LOG_WARN("NTP: no reply from %s", _server);
+      retryLater(now);
+    }
+    return;
+  }
+  uint8_t packet[NTP_PACKET_SIZE];
+  ntpUDP.read(packet, NTP_PACKET_SIZE);
+  ntpUDP.flush();
+
+  const uint8_t mode = packet[0] & 0x07;
+  const uint8_t stratum = packet[1];
+  if ((mode != 4) || (stratum == 0) || (readUint32(packet + 24) != _requestNonce)) {
+    return; // not a reply to this request, or a kiss-of-death; keep waiting until the timeout
+  }
+
+  // server receive (T2) and transmit (T3) times; the reply arrived about half
+  // the round trip, less the server's processing time, after T3
+  const uint64_t serverReceived = timestampToEpochMillis(packet + 32);
+  const uint64_t serverSent     = timestampToEpochMillis(packet + 40);
+  const uint32_t roundTrip = (now - _stateMillis) - (uint32_t)min<uint64_t>(serverSent - serverReceived, now - _stateMillis);
+  const uint64_t serverNow = serverSent + roundTrip / 2;
+
+  TimeBase base = _published;
+  const uint64_t localNow = utcEpochMillis(base, now);
+  const int64_t correction = (int64_t)(serverNow - localNow);
+
+  if (!base.valid || (correction >= STEP_THRESHOLD_MILLIS) || (correction <= -STEP_THRESHOLD_MILLIS)) {
+    base.epochMillis = serverNow;
+    base.slewMillis = 0;
+    LOG_INFO("NTP: clock set from %s, round trip %u ms", _server, (unsigned)roundTrip);
+  } else {
+    base.epochMillis = localNow;
+    base.slewMillis = correction;
+    LOG_INFO("NTP: %s, round trip %u ms, slewing %d ms", _server, (unsigned)roundTrip, (int)correction);
+  }
+  base.atMillis = now;
+  base.valid = true;
+  publish(base);
+
+  _state = IDLE;
+  _retryMillis = 0;
+  _nextRequestMillis = now + NTP_UPDATE_THROTTLE_MILLLISECONDS;
+}
+
+void NtpClock::retryLater(uint32_t now) {
+  _retryMillis = (_retryMillis == 0) ? FIRST_RETRY_MILLIS : min(2 * _retryMillis, (uint32_t)NTP_UPDATE_THROTTLE_MILLLISECONDS);
+  _state = IDLE;
+  _nextRequestMillis = now + _retryMillis;
+}
+
+#else
+
+void NtpClock::begin(const char* server) {
+  _server = server;
+}
+
+void NtpClock::update() {}
+
+#endif // ENABLE_NTP
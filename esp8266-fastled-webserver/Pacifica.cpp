@@ -23,8 +23,9 @@
 //
 // All four wave layers are added together on top of each other, and then 
 // another filter is applied that adds "whitecaps" of brightness where the 
-// waves line up with each other more.  Finally, another pass is taken
-// over the led array to 'deepen' (dim) the blues and greens.
+// waves line up with each other more.  Finally, the blues and greens are
+// 'deepened' (dimmed).  All of this is done for one pixel at a time, in a single
+// pass over the led array, so each pixel is written only once per frame.
 //
 // The speed and scale and motion each layer varies slowly within independent 
 // hand-chosen ranges, which is why the code has a lot of low-speed 'beatsin8' functions
@@ -43,78 +44,42 @@ CRGBPalette16 pacifica_palette_3 =
     { 0x000208, 0x00030E, 0x000514, 0x00061A, 0x000820, 0x000927, 0x000B2D, 0x000C33, 
       0x000E39, 0x001040, 0x001450, 0x001860, 0x001C70, 0x002080, 0x1040BF, 0x2060FF };
 
-// Add one layer of waves into the led array
-void pacifica_one_layer( CRGBPalette16& p, uint16_t cistart, uint16_t wavescale, uint8_t bri, uint16_t ioff, bool useFibonacciOrder)
-{
-  uint16_t ci = cistart;
-  uint16_t waveangle = ioff;
-  uint16_t wavescale_half = (wavescale / 2) + 20;
-  for( uint16_t i = 0; i < NUM_PIXELS; i++) {
-    waveangle += 250;
-    uint16_t s16 = sin16( waveangle ) + 32768;
-    uint16_t cs = scale16( s16 , wavescale_half ) + wavescale_half;
-    ci += cs;
-    uint16_t sindex16 = sin16( ci) + 32768;
+// One layer of waves, evaluated one pixel at a time (in order)
+class PacificaLayer {
+public:
+  PacificaLayer( const CRGBPalette16& p, uint16_t cistart, uint16_t wavescale, uint8_t bri, uint16_t ioff)
+    : _palette(p), _ci(cistart), _waveangle(ioff), _wavescale_half((wavescale / 2) + 20), _bri(bri) {}
+
+  // Color this layer adds to the next pixel
+  CRGB next()
+  {
+    _waveangle += 250;
+    uint16_t s16 = sin16( _waveangle ) + 32768;
+    uint16_t cs = scale16( s16 , _wavescale_half ) + _wavescale_half;
+    _ci += cs;
+    uint16_t sindex16 = sin16( _ci) + 32768;
     uint8_t sindex8 = scale16( sindex16, 240);
-    CRGB c = ColorFromPalette( p, sindex8, bri, LINEARBLEND);
-#if IS_FIBONACCI
-    uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
-#else
-    (void)useFibonacciOrder; // unused parameter
-    uint16_t idx = i;
-#endif
-    leds[idx] += c;
+    return ColorFromPalette( _palette, sindex8, _bri, LINEARBLEND);
   }
-}
 
-// Add extra 'white' to areas where the four layers of light have lined up brightly
-void pacifica_add_whitecaps(bool useFibonacciOrder)
-{
-  uint8_t basethreshold = beatsin8( 9, 55, 65);
-  uint8_t wave = beat8( 7 );
-  
-  for( uint16_t i = 0; i < NUM_PIXELS; i++) {
-#if IS_FIBONACCI
-    uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
-#else
-    (void)useFibonacciOrder; // unused parameter
-    uint16_t idx = i;
-#endif
+private:
+  const CRGBPalette16& _palette;
+  uint16_t _ci;
+  uint16_t _waveangle;
+  uint16_t _wavescale_half;
+  uint8_t _bri;
+};
 
-    uint8_t threshold = scale8( sin8( wave), 20) + basethreshold;
-    wave += 7;
-    uint8_t l = leds[idx].getAverageLight();
-    if( l > threshold) {
-      uint8_t overage = l - threshold;
-      uint8_t overage2 = qadd8( overage, overage);
-      leds[idx] += CRGB( overage, overage2, qadd8( overage2, overage2));
-    }
-  }
-}
+// The "color index start" counters, one for each wave layer.  Outside the template,
+// so that both orders continue the same animation, as when they were one function.
+static uint16_t sCIStart1, sCIStart2, sCIStart3, sCIStart4;
+static uint32_t sLastms = 0;
 
-// Deepen the blues and greens
-void pacifica_deepen_colors(bool useFibonacciOrder)
-{
-  for( uint16_t i = 0; i < NUM_PIXELS; i++) {
-#if IS_FIBONACCI
-    uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
-#else
-    (void)useFibonacciOrder; // unused parameter
-    uint16_t idx = i;
-#endif
-
-    leds[idx].blue = scale8( leds[idx].blue,  145); 
-    leds[idx].green= scale8( leds[idx].green, 200); 
-    leds[idx] |= CRGB( 2, 5, 7);
-  }
-}
-
-void pacifica_loop_impl(bool useFibonacciOrder)
+template <PixelOrder ORDER>
+void pacifica_loop_impl()
 {
   // Increment the four "color index start" counters, one for each wave layer.
   // Each is incremented at a different speed, and the speeds vary over time.
-  static uint16_t sCIStart1, sCIStart2, sCIStart3, sCIStart4;
-  static uint32_t sLastms = 0;
   uint32_t ms = GET_MILLIS();
   uint32_t deltams = ms - sLastms;
   sLastms = ms;
@@ -128,32 +93,57 @@ void pacifica_loop_impl(bool useFibonacciOrder)
   sCIStart3 -= (deltams1 * beatsin88(501,5,7));
   sCIStart4 -= (deltams2 * beatsin88(257,4,6));
 
-  // Clear out the LED array to a dim background blue-green
-  fill_solid( leds, NUM_PIXELS, CRGB( 2, 6, 10));
+  // Four layers, with different scales and speeds, that vary over time
+  PacificaLayer layer1( pacifica_palette_1, sCIStart1, beatsin16( 3, 11 * 256, 14 * 256), beatsin8( 10, 70, 130), 0-beat16( 301) );
+  PacificaLayer layer2( pacifica_palette_2, sCIStart2, beatsin16( 4,  6 * 256,  9 * 256), beatsin8( 17, 40,  80), beat16( 401)   );
+  PacificaLayer layer3( pacifica_palette_3, sCIStart3, 6 * 256,                           beatsin8(  9, 10,  38), 0-beat16(503)  );
+  PacificaLayer layer4( pacifica_palette_3, sCIStart4, 5 * 256,                           beatsin8(  8, 10,  28), beat16(601)    );
+
+  // Whitecaps threshold varies slowly over time, and along the led array
+  uint8_t basethreshold = beatsin8( 9, 55, 65);
+  uint8_t wave = beat8( 7 );
+
+  // Each layer's color index is a running sum along the pixels,
+  // so this pass cannot be split between cores (see ForkJoin.hpp).
+  LogicalPixels<ORDER> pixels;
+  for( uint16_t i = 0; i < NUM_PIXELS; i++) {
+
+    // Start from a dim background blue-green, and add each of the four layers
+    CRGB c( 2, 6, 10);
+    c += layer1.next();
+    c += layer2.next();
+    c += layer3.next();
+    c += layer4.next();
 
-  // Render each of four layers, with different scales and speeds, that vary over time
-  pacifica_one_layer( pacifica_palette_1, sCIStart1, beatsin16( 3, 11 * 256, 14 * 256), beatsin8( 10, 70, 130), 0-beat16( 301), useFibonacciOrder );
-  pacifica_one_layer( pacifica_palette_2, sCIStart2, beatsin16( 4,  6 * 256,  9 * 256), beatsin8( 17, 40,  80), beat16( 401),   useFibonacciOrder );
-  pacifica_one_layer( pacifica_palette_3, sCIStart3, 6 * 256,                           beatsin8(  9, 10,  38), 0-beat16(503),  useFibonacciOrder );
-  pacifica_one_layer( pacifica_palette_3, sCIStart4, 5 * 256,                           beatsin8(  8, 10,  28), beat16(601),    useFibonacciOrder );
+    // Add extra 'white' where the four layers of light have lined up brightly
+    uint8_t threshold = scale8( sin8( wave), 20) + basethreshold;
+    wave += 7;
+    uint8_t l = c.getAverageLight();
+    if( l > threshold) {
+      uint8_t overage = l - threshold;
+      uint8_t overage2 = qadd8( overage, overage);
+      c += CRGB( overage, overage2, qadd8( overage2, overage2));
+    }
 
-  // Add brighter 'whitecaps' where the waves lines up more
-  pacifica_add_whitecaps(useFibonacciOrder);
+    // Deepen the blues and greens
+    c.blue = scale8( c.blue,  145); 
+    c.green= scale8( c.green, 200); 
+    c |= CRGB( 2, 5, 7);
 
-  // Deepen the blues and greens a bit
-  pacifica_deepen_colors(useFibonacciOrder);
+    pixels[i] = c;
+  }
 }
 
 // TODO: Export only these two functions via header file
 void pacifica_loop()
 {
-  return pacifica_loop_impl(false);
+  return pacifica_loop_impl<PIXEL_ORDER_LINEAR>();
 }
 
 #if IS_FIBONACCI
 void pacifica_fibonacci_loop()
 {
-  return pacifica_loop_impl(true);
+  return pacifica_loop_impl<PIXEL_ORDER_FIBONACCI>();
 }
 #endif
 
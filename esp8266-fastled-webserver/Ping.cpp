@@ -33,46 +33,142 @@
 // This was a feature I needed for my own devices, of which there are dozens.  :)
 #include "common.h"
 
-const bool discovery = false;
+// A ping is a blocking HTTPS POST: the TLS handshake alone takes up to a few
+// seconds of CPU on an ESP8266, and cannot be split into smaller steps.  So that
+// the pixels do not freeze, checkPingTimer() only looks up the server (without
+// waiting), and posts only while the energy governor reports the frames as static
+// or off.  A ping that falls due while a pattern is animating is skipped until the
+// next interval.  PING_TIMEOUT_MILLIS bounds each wait for the network, not the
+// handshake's computation, which is why the post never runs while animating.
+// When rendering has its own core, nothing waits for the ping, so it is sent at once.
+
+#include <atomic>
+#include <lwip/dns.h>
+
+const bool discovery = ENABLE_DISCOVERY;
+const char serverHost[] = "ping.evilgeniuslabs.org";
 const String serverName = "https://ping.evilgeniuslabs.org"; // address of server to ping
 // const uint8_t fingerprint[20] { 0xAD, 0x1F, 0xCB, 0xD9, 0xA0, 0xBC, 0x17, 0xD5, 0x5B, 0xF2, 0xE1, 0xBF, 0x98, 0xD1, 0x06, 0xCD, 0xAC, 0x3F, 0xB8, 0x33 }; // server SSL cert fingerprint
 
+static const uint32_t PING_INTERVAL_MILLIS   = 600000; /// 60 * 10 * 1000; // 10 minutes
+static const uint32_t PING_RESOLVE_MILLIS    = 10000;  // give up on this ping when the lookup takes longer
+static const uint16_t PING_TIMEOUT_MILLIS    = 4000;   // each wait to connect, or for the server's reply
+
+enum PingState : uint8_t {
+  PING_WAITING,   // until the next ping is due
+  PING_RESOLVING, // waiting for lwIP to cache the server's address
+  PING_READY,     // resolved, posted at the next check while the frames are idle
+};
+
+enum ResolveState : uint8_t { RESOLVE_PENDING, RESOLVE_DONE, RESOLVE_FAILED };
+
+static PingState pingState = PING_WAITING;
+static uint32_t lastPingTime = PING_INTERVAL_MILLIS; // so the first ping is sent soon after boot
+static uint32_t resolveStartTime = 0;
+static std::atomic<uint8_t> resolveState(RESOLVE_PENDING); // written by the lwIP DNS callback
+
+static void dnsFound(const char*, const ip_addr_t* address, void*) {
+  resolveState.store((address != nullptr) ? RESOLVE_DONE : RESOLVE_FAILED, std::memory_order_release);
+}
+
+// Returns true when the address is already in lwIP's cache, so connecting will
+// not wait for DNS.  Otherwise, starts a lookup that will fill the cache.
+static bool resolveServer() {
+  ip_addr_t address;
+  resolveStartTime = millis();
+  resolveState.store(RESOLVE_PENDING, std::memory_order_relaxed);
+  const err_t result = dns_gethostbyname(serverHost, &address, dnsFound, nullptr);
+  if (result == ERR_OK) {
+    return true;
+  }
+  if (result != ERR_INPROGRESS) {
+    resolveState.store(RESOLVE_FAILED, std::memory_order_relaxed);
+  }
+  return false;
+}
+
+static bool framesCanWait() {
+#if RENDER_TASK_ON_SEPARATE_CORE
+  return true;
+#else
+  return governorStats().state != GOVERNOR_ACTIVE;
+#endif
+}
+
+static void skipPing(uint32_t now) {
+  LOG_INFO("Ping skipped: frames are animating");
+  lastPingTime = now;
+  pingState = PING_WAITING;
+}
+
+static void sendPing() {
+  HTTPClient http;
+  BearSSL::WiFiClientSecure client;
+
+  //client.setFingerprint(fingerprint);
+  client.setInsecure();
+  client.setTimeout(PING_TIMEOUT_MILLIS);
+  http.setTimeout(PING_TIMEOUT_MILLIS);
+  http.begin(client, serverName);
+  http.addHeader("Content-Type", "application/json");
+  String deviceName = "\"deviceName\":\"" + nameString;
+  String localIp = WiFi.localIP().toString();
+  String macAddress = WiFi.macAddress();
+  String body = "{" +
+                deviceName +
+                "\",\"localIp\":\"" + localIp +
+                "\",\"macAddress\":\"" + macAddress +
+                "\",\"millis\":" + String(millis()) +
+                "}";
+  LOG_INFO("Pinging %s with: %s", serverName.c_str(), body.c_str());
+  const uint32_t start = millis();
+  int httpResponseCode = http.POST(body);
+  http.end();
+  LOG_INFO("Ping response code: %d, took %u ms", httpResponseCode, (unsigned)(millis() - start));
+}
+
 void checkPingTimer() {
   if (!discovery) return;
-  
-  const unsigned long pingDelay = 600000; /// 60 * 10 * 1000; // 10 minutes
-  static unsigned long lastPingTime = pingDelay;
-
-  if ((millis() - lastPingTime) > pingDelay) {
-    // Serial.println("Time to ping");
-    
-    // Check WiFi connection status
-    if (WiFi.status() == WL_CONNECTED) {
-      Serial.println("Connected, ready to ping");
-
-      HTTPClient http;
-      BearSSL::WiFiClientSecure client;
-
-      //client.setFingerprint(fingerprint);
-      client.setInsecure();
-      http.begin(client, serverName);
-      http.addHeader("Content-Type", "application/json");
-      String deviceName = "\"deviceName\":\"" + nameString;
-      String localIp = WiFi.localIP().toString();
-      String macAddress = WiFi.macAddress();
-      String body = "{" +
-                    deviceName +
-                    "\",\"localIp\":\"" + localIp +
-                    "\",\"macAddress\":\"" + macAddress +
-                    "\",\"millis\":" + String(millis()) +
-                    "}";
-      Serial.print("Pinging "); Serial.print(serverName); Serial.print(" with: ");
-      Serial.println(body);
-      Serial.print("Millis: "); Serial.println(millis());
-      int httpResponseCode = http.POST(body);
-      Serial.print("Millis: "); Serial.println(millis());
-      Serial.print("Ping response code: "); Serial.println(httpResponseCode);
-      lastPingTime = millis();
-    }
+
+  const uint32_t now = millis();
+  if (WiFi.status() != WL_CONNECTED) {
+    pingState = PING_WAITING;
+    return;
+  }
+
+  switch (pingState) {
+    case PING_WAITING:
+      if (now - lastPingTime > PING_INTERVAL_MILLIS) {
+        if (!framesCanWait()) {
+          skipPing(now);
+          break;
+        }
+        pingState = resolveServer() ? PING_READY : PING_RESOLVING;
+      }
+      break;
+
+    case PING_RESOLVING:
+      if (resolveState.load(std::memory_order_acquire) == RESOLVE_DONE) {
+        pingState = PING_READY;
+      } else if ((resolveState.load(std::memory_order_acquire) == RESOLVE_FAILED) || (now - resolveStartTime >= PING_RESOLVE_MILLIS)) {
+        LOG_WARN("Ping skipped: could not resolve %s", serverHost);
+        lastPingTime = now;
+        pingState = PING_WAITING;
+      }
+      break;
+
+    case PING_READY:
+      if (!framesCanWait()) {
+        skipPing(now); // started animating during the lookup
+        break;
+      }
+      if (!resolveServer()) {
+        pingState = PING_RESOLVING; // the cached address expired while waiting
+      } else {
+        sendPing();
+        lastPingTime = millis();
+        pingState = PING_WAITING;
+      }
+      break;
   }
 }
@@ -0,0 +1,88 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+#if LOGICAL_RENDER_BUFFER
+
+// aligned for the word-at-a-time kernels in SwarKernels.hpp
+alignas(4) static CRGB logicalLeds[NUM_PIXELS];
+static PixelOrder logicalOrder = PIXEL_ORDER_LINEAR;
+static bool logicalFrameStarted = false; // a pattern wrote logicalLeds[] this frame
+static bool logicalLedsCurrent = false;  // logicalLeds[] holds what leds[] shows, in logicalOrder
+
+CRGB* beginLogicalFrame(PixelOrder order) {
+  // Patterns such as Pride blend into the previous frame.  Unless that frame
+  // came from this buffer, in the same order, gather it from leds[].
+  if (!logicalLedsCurrent || (order != logicalOrder)) {
+    for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+      logicalLeds[i] = leds[physicalPixelIndex(order, i)];
+    }
+  }
+  logicalOrder = order;
+  logicalFrameStarted = true;
+  return logicalLeds;
+}
+
+// One loop per order, so the permutation is not re-decided for every pixel
+void outputLogicalPixels() {
+  logicalLedsCurrent = logicalFrameStarted;
+  if (!logicalFrameStarted) {
+    return;
+  }
+  logicalFrameStarted = false;
+
+  switch (logicalOrder) {
+    case PIXEL_ORDER_LINEAR:
+      memcpy(leds, logicalLeds, sizeof(leds));
+      break;
+    case PIXEL_ORDER_REVERSED:
+      for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+        leds[(NUM_PIXELS - 1) - i] = logicalLeds[i];
+      }
+      break;
+#if IS_FIBONACCI
+    case PIXEL_ORDER_FIBONACCI: {
+      MapTableStream<fibonacci_index_t> physical(fibonacciToPhysical);
+      for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+        leds[physical.next()] = logicalLeds[i];
+      }
+      break;
+    }
+    case PIXEL_ORDER_REVERSED_FIBONACCI: {
+      MapTableStream<fibonacci_index_t> physical(fibonacciToPhysical);
+      for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+        leds[(NUM_PIXELS - 1) - physical.next()] = logicalLeds[i];
+      }
+      break;
+    }
+#endif
+    default:
+      for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+        leds[physicalPixelIndex(logicalOrder, i)] = logicalLeds[i];
+      }
+      break;
+  }
+}
+
+// leds[] was changed outside of the logical buffer (e.g., the clock overlay)
+void invalidateLogicalPixels() {
+  logicalLedsCurrent = false;
+}
+
+#endif // LOGICAL_RENDER_BUFFER
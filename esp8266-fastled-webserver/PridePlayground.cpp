@@ -30,12 +30,16 @@ uint8_t sHueBpm = 2;
 uint8_t sHueMin = 5;
 uint8_t sHueMax = 9;
 
-void fillWithPridePlayground(bool useFibonacciOrder)
+// One animation for both orders, so that switching between pridePlayground() and
+// pridePlaygroundFibonacci() does not restart it
+static uint16_t sPridePlaygroundPseudotime = 0;
+static uint16_t sPridePlaygroundLastMillis = 0;
+static uint16_t sPridePlaygroundHue16 = 0;
+
+// ORDER is PIXEL_ORDER_REVERSED, optionally with PIXEL_ORDER_FIBONACCI
+template <PixelOrder ORDER>
+void fillWithPridePlayground()
 {
-  static uint16_t sPseudotime = 0;
-  static uint16_t sLastMillis = 0;
-  static uint16_t sHue16 = 0;
-
   uint8_t sat8 = beatsin88(saturationBpm, saturationMin, saturationMax);
 
   uint8_t brightdepth = beatsin88(brightDepthBpm * 256, brightDepthMin, brightDepthMax);
@@ -43,49 +47,49 @@ void fillWithPridePlayground(bool useFibonacciOrder)
   
   uint8_t msmultiplier = beatsin88(msMultiplierBpm, msMultiplierMin, msMultiplierMax);
 
-  uint16_t hue16 = sHue16; //gHue * 256;
+  const uint16_t hue16Start = sPridePlaygroundHue16; //gHue * 256;
   uint16_t hueinc16 = beatsin88(hueIncBpm, hueIncMin, hueIncMax * 256);
 
-  uint16_t ms = millis();
-  uint16_t deltams = ms - sLastMillis;
-  sLastMillis = ms;
-  sPseudotime += deltams * msmultiplier;
-  sHue16 += deltams * beatsin88(sHueBpm * 256, sHueMin, sHueMax);
-  uint16_t brightnesstheta16 = sPseudotime;
-
-  for (uint16_t i = 0; i < NUM_PIXELS; i++)
-  {
-    hue16 += hueinc16;
-    uint8_t hue8 = hue16 / 256;
-
-    brightnesstheta16 += brightnessthetainc16;
-    uint16_t b16 = sin16(brightnesstheta16) + 32768;
-
-    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
-    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
-    bri8 += (255 - brightdepth);
-
-    CRGB newcolor = CHSV(hue8, sat8, bri8);
-
-    uint16_t pixelnumber = i;
-#if IS_FIBONACCI
-    if (useFibonacciOrder) pixelnumber = fibonacciToPhysical[i];
-#else
-    (void)useFibonacciOrder;
-#endif
-
-    pixelnumber = (NUM_PIXELS - 1) - pixelnumber;
-
-    nblend(leds[pixelnumber], newcolor, 64);
-  }
+  uint16_t ms = GET_MILLIS();
+  uint16_t deltams = ms - sPridePlaygroundLastMillis;
+  sPridePlaygroundLastMillis = ms;
+  sPridePlaygroundPseudotime += deltams * msmultiplier;
+  sPridePlaygroundHue16 += deltams * beatsin88(sHueBpm * 256, sHueMin, sHueMax);
+  const uint16_t brightnesstheta16Start = sPridePlaygroundPseudotime;
+  BrightnessWave brightness(brightdepth);
+  RainbowTable rainbow(sat8);
+
+  LogicalPixels<ORDER> pixels;
+
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    // hue and brightness phase advance by a fixed step per pixel,
+    // so each range can start part-way through the sequence
+    uint16_t hue16 = hue16Start + first * hueinc16;
+    uint16_t brightnesstheta16 = brightnesstheta16Start + first * brightnessthetainc16;
+    RowBlender<ORDER> blender(pixels, first, 64);
+
+    for (uint16_t i = first; i < last; i++) {
+      hue16 += hueinc16;
+      uint8_t hue8 = hue16 / 256;
+
+      brightnesstheta16 += brightnessthetainc16;
+      uint8_t bri8 = brightness(brightnesstheta16);
+
+      CRGB newcolor = rainbow(hue8, bri8);
+
+      blender.push(newcolor);
+    }
+    blender.flush();
+  };
+  forEachPixelRange(NUM_PIXELS, kernel);
 }
 
 void pridePlayground() {
-  fillWithPridePlayground(false);
+  fillWithPridePlayground<PIXEL_ORDER_REVERSED>();
 }
 
 #if IS_FIBONACCI
 void pridePlaygroundFibonacci() {
-  fillWithPridePlayground(true);
+  fillWithPridePlayground<PIXEL_ORDER_REVERSED_FIBONACCI>();
 }
 #endif
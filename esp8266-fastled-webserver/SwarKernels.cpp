@@ -0,0 +1,95 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+#if SWAR_PIXEL_KERNELS
+
+static const uint32_t EVEN_BYTES = 0x00FF00FFu;
+
+static inline uintptr_t misalignment(const void* p) {
+  return reinterpret_cast<uintptr_t>(p) & 3;
+}
+
+void nscale8Packed(CRGB* leds, uint16_t count, uint8_t scale) {
+  uint8_t* p = reinterpret_cast<uint8_t*>(leds);
+  uint8_t* const end = p + (sizeof(CRGB) * count);
+  const uint32_t multiplier = scale + 1; // scale8() == (i * (scale + 1)) >> 8
+
+  // leading bytes, up to the first word boundary
+  while ((p < end) && misalignment(p)) {
+    *p = (*p * multiplier) >> 8;
+    p++;
+  }
+  // whole words
+  packed_word_t* w = reinterpret_cast<packed_word_t*>(p);
+  packed_word_t* const wordsEnd = w + ((end - p) / 4);
+  for (; w < wordsEnd; w++) {
+    const uint32_t v = *w;
+    const uint32_t even = (((v      ) & EVEN_BYTES) * multiplier >> 8) & EVEN_BYTES;
+    const uint32_t odd  = (((v >> 8 ) & EVEN_BYTES) * multiplier     ) & ~EVEN_BYTES;
+    *w = even | odd;
+  }
+  // trailing bytes
+  for (p = reinterpret_cast<uint8_t*>(w); p < end; p++) {
+    *p = (*p * multiplier) >> 8;
+  }
+}
+
+void nblendPacked(CRGB* existing, const CRGB* overlay, uint16_t count, fract8 amountOfOverlay) {
+  uint8_t* a = reinterpret_cast<uint8_t*>(existing);
+  const uint8_t* b = reinterpret_cast<const uint8_t*>(overlay);
+  uint8_t* const end = a + (sizeof(CRGB) * count);
+  // blend8() == (a * (256 - amount) + b * (amount + 1)) >> 8
+  const uint32_t amountOfA = 256 - amountOfOverlay;
+  const uint32_t amountOfB = amountOfOverlay + 1;
+
+  if (misalignment(a) == misalignment(b)) {
+    while ((a < end) && misalignment(a)) {
+      *a = (*a * amountOfA + *b * amountOfB) >> 8;
+      a++; b++;
+    }
+    packed_word_t* wa = reinterpret_cast<packed_word_t*>(a);
+    const packed_word_t* wb = reinterpret_cast<const packed_word_t*>(b);
+    packed_word_t* const wordsEnd = wa + ((end - a) / 4);
+    for (; wa < wordsEnd; wa++, wb++) {
+      const uint32_t va = *wa;
+      const uint32_t vb = *wb;
+      const uint32_t even = ((((va     ) & EVEN_BYTES) * amountOfA + ((vb     ) & EVEN_BYTES) * amountOfB) >> 8) & EVEN_BYTES;
+      const uint32_t odd  = ((((va >> 8) & EVEN_BYTES) * amountOfA + ((vb >> 8) & EVEN_BYTES) * amountOfB)     ) & ~EVEN_BYTES;
+      *wa = even | odd;
+    }
+    a = reinterpret_cast<uint8_t*>(wa);
+    b = reinterpret_cast<const uint8_t*>(wb);
+  }
+  for (; a < end; a++, b++) {
+    *a = (*a * amountOfA + *b * amountOfB) >> 8;
+  }
+}
+
+#else
+
+void nscale8Packed(CRGB* leds, uint16_t count, uint8_t scale) {
+  nscale8(leds, count, scale);
+}
+
+void nblendPacked(CRGB* existing, const CRGB* overlay, uint16_t count, fract8 amountOfOverlay) {
+  nblend(existing, overlay, count, amountOfOverlay);
+}
+
+#endif // SWAR_PIXEL_KERNELS
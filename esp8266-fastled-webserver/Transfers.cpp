@@ -0,0 +1,176 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+static const uint8_t  TRANSFER_SLOTS        = 4;    // concurrent transfers, e.g. one per browser tab
+static const uint32_t TRANSFER_STALL_MILLIS = 5000; // give up on a client that takes nothing for this long
+
+typedef struct {
+  WiFiClient client;
+  File       file;      // when sending from the file system ...
+  PGM_P      flash;     // ... or else from flash
+  uint32_t   remaining; // zero when the slot is free
+  uint32_t   lastProgressMillis;
+} Transfer;
+
+static Transfer transfers[TRANSFER_SLOTS];
+static uint8_t nextSlot = 0; // round-robin
+static uint8_t chunk[TRANSFER_CHUNK_BYTES]; // only used by the network task
+
+static void finish(Transfer& transfer) {
+  if (transfer.file) {
+    transfer.file.close();
+  }
+  transfer.client = WiFiClient(); // the connection closes once the web server has let go of it, too
+  transfer.flash = nullptr;
+  transfer.remaining = 0;
+}
+
+static uint32_t writableBytes(WiFiClient& client) {
+  #if defined(ARDUINO_ARCH_ESP32)
+    (void)client;
+    return TRANSFER_CHUNK_BYTES; // no availableForWrite(); a socket write returns once buffered
+  #else
+    return client.availableForWrite(); // free TCP send buffer
+  #endif
+}
+
+static size_t writeFlash(WiFiClient& client, PGM_P data, size_t size) {
+  #if defined(ARDUINO_ARCH_ESP32)
+    return client.write(reinterpret_cast<const uint8_t*>(data), size); // flash is memory-mapped
+  #else
+    return client.write_P(data, size);
+  #endif
+}
+
+// Frees the slots of clients that are gone, or that took nothing for
+// TRANSFER_STALL_MILLIS; every slot, whether or not it gets to send a chunk
+static void expireTransfers() {
+  const uint32_t now = millis();
+  for (uint8_t i = 0; i < TRANSFER_SLOTS; i++) {
+    Transfer& transfer = transfers[i];
+    if (transfer.remaining == 0) {
+      continue;
+    }
+    if (!transfer.client.connected()) {
+      LOG_DEBUG("transfer: client gone, %u bytes unsent", (unsigned)transfer.remaining);
+      finish(transfer);
+    } else if (now - transfer.lastProgressMillis > TRANSFER_STALL_MILLIS) {
+      LOG_WARN("transfer: stalled, %u bytes unsent", (unsigned)transfer.remaining);
+      transfer.client.stop();
+      finish(transfer);
+    }
+  }
+}
+
+// Returns the number of bytes sent
+static uint32_t sendChunk(Transfer& transfer) {
+  const uint32_t count = min(min(transfer.remaining, (uint32_t)TRANSFER_CHUNK_BYTES), writableBytes(transfer.client));
+  if (count == 0) {
+    return 0; // waiting for the network; expireTransfers() gives up on it eventually
+  }
+
+  size_t sent;
+  if (transfer.flash != nullptr) {
+    sent = writeFlash(transfer.client, transfer.flash, count);
+    transfer.flash += sent;
+  } else {
+    const size_t read = transfer.file.read(chunk, count);
+    sent = (read > 0) ? transfer.client.write(chunk, read) : 0;
+    if (sent != count) {
+      // the file shrank, or the connection failed; the client sees a short response
+      LOG_WARN("transfer: %u of %u bytes sent", (unsigned)sent, (unsigned)count);
+      transfer.client.stop();
+      finish(transfer);
+      return sent;
+    }
+  }
+  transfer.remaining -= sent;
+  transfer.lastProgressMillis = millis();
+  if (transfer.remaining == 0) {
+    finish(transfer);
+  }
+  return sent;
+}
+
+static Transfer* claimSlot(uint32_t size) {
+  if (RENDER_TASK_ON_SEPARATE_CORE || (size == 0)) {
+    return nullptr; // frames are drawn on the other core, so there is nothing to interleave with
+  }
+  for (uint8_t i = 0; i < TRANSFER_SLOTS; i++) {
+    if (transfers[i].remaining == 0) {
+      Transfer& transfer = transfers[i];
+      transfer.client = webServer.client();
+      transfer.remaining = size;
+      transfer.lastProgressMillis = millis();
+      return &transfer;
+    }
+  }
+  LOG_DEBUG("transfer: all %u slots busy", (unsigned)TRANSFER_SLOTS);
+  return nullptr;
+}
+
+void transferFile(File& file) {
+  Transfer* transfer = claimSlot(file.size() - file.position());
+  if (transfer == nullptr) {
+    webServer.client().write(file);
+    file.close();
+    return;
+  }
+  transfer->file = file;
+  file = File(); // the slot closes it
+  sendChunk(*transfer);
+}
+
+void transferFlash(PGM_P data, uint32_t size) {
+  Transfer* transfer = claimSlot(size);
+  if (transfer == nullptr) {
+    webServer.sendContent_P(data, size);
+    return;
+  }
+  transfer->flash = data;
+  sendChunk(*transfer);
+}
+
+void pumpTransfers(uint32_t budgetMicros) {
+  const uint32_t start = micros();
+  expireTransfers();
+  uint8_t idleSlots = 0; // consecutive slots that sent nothing
+  while (idleSlots < TRANSFER_SLOTS) {
+    Transfer& transfer = transfers[nextSlot];
+    nextSlot = (nextSlot + 1) % TRANSFER_SLOTS;
+    if ((transfer.remaining == 0) || (sendChunk(transfer) == 0)) {
+      idleSlots++;
+      continue;
+    }
+    idleSlots = 0;
+    if (micros() - start >= budgetMicros) {
+      return;
+    }
+  }
+}
+
+bool transfersPending() {
+  for (uint8_t i = 0; i < TRANSFER_SLOTS; i++) {
+    if (transfers[i].remaining != 0) {
+      return true;
+    }
+  }
+  return false;
+}
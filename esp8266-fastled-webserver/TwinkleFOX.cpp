@@ -158,6 +158,78 @@ CRGB computeOneTwinkle( uint32_t ms, uint8_t salt)
   return c;
 }
 
+// "PRNG16" is the pseudorandom number generator
+// It MUST be reset to the same starting value each time
+// drawTwinkles() is called, so that the sequence of 'random'
+// numbers that it generates is (paradoxically) stable.
+static const uint16_t twinklePrngSeed = 11337;
+
+// Returns the value PRNG16 would have after 'steps' more steps,
+// without generating all the values in between, so that a range of
+// pixels can be rendered without first walking all the pixels before it.
+static uint16_t twinklePrngSkip(uint16_t PRNG16, uint32_t steps)
+{
+  // (multiplier, increment) of the combined step for the current bit of 'steps'
+  uint16_t multiplier = 2053;
+  uint16_t increment = 1384;
+  while (steps) {
+    if (steps & 1) {
+      PRNG16 = (uint16_t)(PRNG16 * multiplier) + increment;
+    }
+    increment = (uint16_t)(increment * multiplier) + increment;
+    multiplier = (uint16_t)(multiplier * multiplier);
+    steps >>= 1;
+  }
+  return PRNG16;
+}
+
+// Everything drawTwinkles() derives from PRNG16 for one pixel.
+typedef struct {
+  uint16_t clockOffset16;       // clock offset
+  uint8_t  speedMultiplierQ5_3; // clock speed adjustment factor (in 8ths, from 8/8ths to 23/8ths)
+  uint8_t  salt;                // 'salt' value for this pixel
+} TwinklePixel;
+static_assert(sizeof(TwinklePixel) == 4, "");
+
+// Advances PRNG16 past one pixel, returning that pixel's values.
+static inline TwinklePixel nextTwinklePixel(uint16_t& PRNG16)
+{
+  TwinklePixel result;
+  PRNG16 = (uint16_t)(PRNG16 * 2053) + 1384; // next 'random' number
+  result.clockOffset16 = PRNG16; // use that number as clock offset
+  PRNG16 = (uint16_t)(PRNG16 * 2053) + 1384; // next 'random' number
+  // use that number as clock speed adjustment factor (in 8ths, from 8/8ths to 23/8ths)
+  result.speedMultiplierQ5_3 = ((((PRNG16 & 0xFF)>>4) + (PRNG16 & 0x0F)) & 0x0F) + 0x08;
+  result.salt = PRNG16 >> 8; // get 'salt' value for this pixel
+  return result;
+}
+
+// The PRNG16 sequence never changes, so neither do the per-pixel values.
+// With TWINKLEFOX_PIXEL_TABLE, trade 4 bytes of heap per pixel, only while a
+// TwinkleFOX pattern is shown, for not recomputing them every frame.  The table
+// is built on the first frame, and freed when the pattern changes.
+static TwinklePixel* twinklePixels = nullptr;
+
+#if TWINKLEFOX_PIXEL_TABLE
+static void buildTwinklePixels()
+{
+  twinklePixels = static_cast<TwinklePixel*>(malloc(sizeof(TwinklePixel) * NUM_PIXELS));
+  if (twinklePixels == nullptr) {
+    return; // short of heap: derive the values every frame instead
+  }
+  uint16_t PRNG16 = twinklePrngSeed;
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    twinklePixels[i] = nextTwinklePixel(PRNG16);
+  }
+}
+#endif
+
+void releaseTwinkleFoxPixels()
+{
+  free(twinklePixels);
+  twinklePixels = nullptr;
+}
+
 //  This function loops over each pixel, calculates the
 //  adjusted 'clock' that this pixel should use, and calls
 //  "CalculateOneTwinkle" on each pixel.  It then displays
@@ -165,13 +237,7 @@ CRGB computeOneTwinkle( uint32_t ms, uint8_t salt)
 //  whichever is brighter.
 void drawTwinkles()
 {
-  // "PRNG16" is the pseudorandom number generator
-  // It MUST be reset to the same starting value each time
-  // this function is called, so that the sequence of 'random'
-  // numbers that it generates is (paradoxically) stable.
-  uint16_t PRNG16 = 11337;
-
-  uint32_t clock32 = millis();
+  uint32_t clock32 = GET_MILLIS();
 
   // Set up the background color, "bg".
   // if AUTO_SELECT_BACKGROUND_COLOR == 1, and the first two colors of
@@ -195,38 +261,47 @@ void drawTwinkles()
 
   uint8_t backgroundBrightness = bg.getAverageLight();
 
-  for(uint16_t i = 0; i < NUM_PIXELS; i++) {
-    CRGB& pixel = leds[i];
-
-    PRNG16 = (uint16_t)(PRNG16 * 2053) + 1384; // next 'random' number
-    uint16_t myclockoffset16= PRNG16; // use that number as clock offset
-    PRNG16 = (uint16_t)(PRNG16 * 2053) + 1384; // next 'random' number
-    // use that number as clock speed adjustment factor (in 8ths, from 8/8ths to 23/8ths)
-    uint8_t myspeedmultiplierQ5_3 =  ((((PRNG16 & 0xFF)>>4) + (PRNG16 & 0x0F)) & 0x0F) + 0x08;
-    uint32_t myclock30 = (uint32_t)((clock32 * myspeedmultiplierQ5_3) >> 3) + myclockoffset16;
-    uint8_t  myunique8 = PRNG16 >> 8; // get 'salt' value for this pixel
-
-    // We now have the adjusted 'clock' for this pixel, now we call
-    // the function that computes what color the pixel should be based
-    // on the "brightness = f( time )" idea.
-    CRGB c = computeOneTwinkle( myclock30, myunique8);
-
-    uint8_t cbright = c.getAverageLight();
-    int16_t deltabright = cbright - backgroundBrightness;
-    if( deltabright >= 32 || (!bg)) {
-      // If the new pixel is significantly brighter than the background color,
-      // use the new color.
-      pixel = c;
-    } else if( deltabright > 0 ) {
-      // If the new pixel is just slightly brighter than the background color,
-      // mix a blend of the new color and the background color
-      pixel = blend( bg, c, deltabright * 8);
-    } else {
-      // if the new pixel is not at all brighter than the background color,
-      // just use the background color.
-      pixel = bg;
-    }
+  #if TWINKLEFOX_PIXEL_TABLE
+  if (twinklePixels == nullptr) {
+    buildTwinklePixels(); // before the pixels are split between cores
   }
+  #endif
+  const TwinklePixel* const table = twinklePixels;
+
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    // Each pixel consumes two numbers from PRNG16, so skip ahead to this range's first pixel.
+    uint16_t PRNG16 = (table != nullptr) ? 0 : twinklePrngSkip(twinklePrngSeed, 2 * (uint32_t)first);
+
+    for(uint16_t i = first; i < last; i++) {
+      CRGB& pixel = leds[i];
+
+      const TwinklePixel my = (table != nullptr) ? table[i] : nextTwinklePixel(PRNG16);
+      uint32_t myclock30 = (uint32_t)((clock32 * my.speedMultiplierQ5_3) >> 3) + my.clockOffset16;
+      uint8_t  myunique8 = my.salt;
+
+      // We now have the adjusted 'clock' for this pixel, now we call
+      // the function that computes what color the pixel should be based
+      // on the "brightness = f( time )" idea.
+      CRGB c = computeOneTwinkle( myclock30, myunique8);
+
+      uint8_t cbright = c.getAverageLight();
+      int16_t deltabright = cbright - backgroundBrightness;
+      if( deltabright >= 32 || (!bg)) {
+        // If the new pixel is significantly brighter than the background color,
+        // use the new color.
+        pixel = c;
+      } else if( deltabright > 0 ) {
+        // If the new pixel is just slightly brighter than the background color,
+        // mix a blend of the new color and the background color
+        pixel = blend( bg, c, deltabright * 8);
+      } else {
+        // if the new pixel is not at all brighter than the background color,
+        // just use the background color.
+        pixel = bg;
+      }
+    }
+  };
+  forEachPixelRange(NUM_PIXELS, kernel);
 }
 
 // A mostly red palette with green accents and white trim.
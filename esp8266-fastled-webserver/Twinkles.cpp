@@ -23,73 +23,132 @@ CRGB makeDarker( const CRGB& color, fract8 howMuchDarker)
   return newcolor;
 }
 
-// Compact implementation of
-// the directionFlags array, using just one BIT of RAM
-// per pixel.  This requires a bunch of bit wrangling,
-// but conserves precious RAM.  The cost is a few
-// cycles and about 100 bytes of flash program memory.
-uint8_t  directionFlags[ (NUM_PIXELS + 7) / 8];
-
-bool getPixelDirection( uint16_t i)
-{
-  uint16_t index = i / 8;
-  uint8_t  bitNum = i & 0x07;
-
-  uint8_t  andMask = 1 << bitNum;
-  return (directionFlags[index] & andMask) != 0;
+// Only a few pixels are lit at any time (each twinkle lasts a fixed number of
+// steps, and at most one is added per step), so keep a list of the lit pixels,
+// and step only those, rather than every pixel.
+typedef struct {
+  uint16_t index;     // into leds[]
+  uint8_t  direction; // GETTING_DARKER or GETTING_BRIGHTER
+  CRGB     color;     // new color, while stepping
+} ActiveTwinkle;
+
+// Steps for a twinkle's brightest channel to brighten from m to 255, and to darken from m to 0
+constexpr uint16_t stepsToFull(uint16_t m) {
+  return (m >= 255) ? 0 : 1 + stepsToFull(m + ((m * (FADE_IN_SPEED + 1)) >> 8));
 }
-
-void setPixelDirection( uint16_t i, bool dir)
-{
-  uint16_t index = i / 8;
-  uint8_t  bitNum = i & 0x07;
-
-  uint8_t  orMask = 1 << bitNum;
-  uint8_t andMask = 255 - orMask;
-  uint8_t value = directionFlags[index] & andMask;
-  if ( dir ) {
-    value += orMask;
-  }
-  directionFlags[index] = value;
+constexpr uint16_t stepsToBlack(uint16_t m) {
+  return (m == 0) ? 0 : 1 + stepsToBlack((m * (256 - FADE_OUT_SPEED)) >> 8);
 }
+// The dimmest channel makeBrighter() changes at all.  A twinkle whose brightest
+// channel starts dimmer never brightens, and stays lit (none of the palettes
+// below does that: their dimmest twinkle starts at 21).
+static const uint8_t dimmestBrighteningChannel = (256 + FADE_IN_SPEED) / (FADE_IN_SPEED + 1);
+static const uint16_t longestTwinkleSteps = stepsToFull(dimmestBrighteningChannel) + stepsToBlack(255);
+
+// A twinkle is dropped on its last step, before the next is added, so at most
+// longestTwinkleSteps are ever listed: the list never limits how many are added.
+static const uint8_t maxActiveTwinkles = (NUM_PIXELS < longestTwinkleSteps) ? NUM_PIXELS : longestTwinkleSteps;
+static_assert(longestTwinkleSteps <= 255, "activeTwinkleCount is a uint8_t");
+// On the heap while one of these patterns is shown (see releaseTwinkleList())
+static ActiveTwinkle* activeTwinkles = nullptr;
+static uint8_t activeTwinkleCount = 0;
+
+// Pixels that are lit, but not in the list (e.g., left over from the previous pattern,
+// or drawn by the clock overlay) must fade out as before, which needs a pass over every pixel.
+static bool strayPixelsLit = true;
 
 void brightenOrDarkenEachPixel( fract8 fadeUpAmount, fract8 fadeDownAmount)
 {
-  for ( uint16_t i = 0; i < NUM_PIXELS; i++) {
-    if ( getPixelDirection(i) == GETTING_DARKER) {
+  for ( uint8_t n = 0; n < activeTwinkleCount; n++) {
+    ActiveTwinkle& twinkle = activeTwinkles[n];
+    const CRGB& current = leds[twinkle.index];
+    if ( twinkle.direction == GETTING_DARKER) {
       // This pixel is getting darker
-      leds[i] = makeDarker( leds[i], fadeDownAmount);
+      twinkle.color = makeDarker( current, fadeDownAmount);
     } else {
       // This pixel is getting brighter
-      leds[i] = makeBrighter( leds[i], fadeUpAmount);
+      twinkle.color = makeBrighter( current, fadeUpAmount);
       // now check to see if we've maxxed out the brightness
-      if ( leds[i].r == 255 || leds[i].g == 255 || leds[i].b == 255) {
+      if ( twinkle.color.r == 255 || twinkle.color.g == 255 || twinkle.color.b == 255) {
         // if so, turn around and start getting darker
-        setPixelDirection(i, GETTING_DARKER);
+        twinkle.direction = GETTING_DARKER;
       }
     }
   }
+
+  if ( strayPixelsLit) {
+    // every pixel not in the list is getting darker
+    for ( uint16_t i = 0; i < NUM_PIXELS; i++) {
+      leds[i] = makeDarker( leds[i], fadeDownAmount);
+    }
+  }
+
+  // write back the listed pixels, and drop those that have faded to black
+  uint8_t kept = 0;
+  for ( uint8_t n = 0; n < activeTwinkleCount; n++) {
+    const ActiveTwinkle& twinkle = activeTwinkles[n];
+    leds[twinkle.index] = twinkle.color;
+    if ( twinkle.color) {
+      activeTwinkles[kept++] = twinkle;
+    }
+  }
+  activeTwinkleCount = kept;
+
+  if ( strayPixelsLit) {
+    uint16_t litCount = 0;
+    for ( uint16_t i = 0; i < NUM_PIXELS; i++) {
+      if ( leds[i]) litCount++;
+    }
+    strayPixelsLit = (litCount != activeTwinkleCount);
+  }
 }
 
 void colortwinkles()
 {
+  // If this pattern was not running a moment ago, leds[] holds whatever was drawn instead.
+  static uint32_t lastMillis = 0;
+  uint32_t now = GET_MILLIS();
+  if ( (now - lastMillis) > 250 || renderParameters().showClock) {
+    strayPixelsLit = true;
+  }
+  lastMillis = now;
+
   EVERY_N_MILLIS(30)
   {
     // Make each pixel brighter or darker, depending on
     // its 'direction' flag.
     brightenOrDarkenEachPixel( FADE_IN_SPEED, FADE_OUT_SPEED);
   
+    if ( activeTwinkles == nullptr) {
+      // short of heap, this only fades out what is lit
+      activeTwinkles = static_cast<ActiveTwinkle*>(malloc(sizeof(ActiveTwinkle) * maxActiveTwinkles));
+    }
+
     // Now consider adding a new random twinkle
-    if ( random8() < DENSITY ) {
+    // (the list only fills up with twinkles that never brighten; see maxActiveTwinkles)
+    if ( random8() < DENSITY && activeTwinkles != nullptr && activeTwinkleCount < maxActiveTwinkles) {
       int pos = random16(NUM_PIXELS);
       if ( !leds[pos]) {
         leds[pos] = ColorFromPalette( gCurrentPalette, random8(), STARTING_BRIGHTNESS, NOBLEND);
-        setPixelDirection(pos, GETTING_BRIGHTER);
+        if ( leds[pos]) { // a black palette entry would never brighten
+          ActiveTwinkle& twinkle = activeTwinkles[activeTwinkleCount++];
+          twinkle.index = pos;
+          twinkle.direction = GETTING_BRIGHTER;
+        }
       }
     }
   }
 }
 
+// The pixels still lit fade out as stray pixels, if this pattern is shown again
+void releaseTwinkleList()
+{
+  free(activeTwinkles);
+  activeTwinkles = nullptr;
+  activeTwinkleCount = 0;
+  strayPixelsLit = true;
+}
+
 void cloudTwinkles()
 {
   gCurrentPalette = CloudColors_p; // Blues and whites!
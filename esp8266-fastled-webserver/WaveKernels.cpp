@@ -0,0 +1,70 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+// Stay nullptr when NUM_PIXELS < 256 (see WaveKernels.hpp)
+static uint8_t* brightnessTable = nullptr;
+static CRGB* rainbowTable = nullptr;
+#if NUM_PIXELS >= 256
+static uint8_t brightnessTableDepth = 0;
+static uint8_t rainbowTableSat = 0;
+#endif
+
+BrightnessWave::BrightnessWave(uint8_t depth) : _depth(depth) {
+#if NUM_PIXELS >= 256
+  if (brightnessTable == nullptr) {
+    brightnessTable = static_cast<uint8_t*>(malloc(256));
+    if (brightnessTable != nullptr) {
+      brightnessTableDepth = ~depth; // so that it is built below
+    }
+  }
+  if ((brightnessTable != nullptr) && (depth != brightnessTableDepth)) {
+    for (uint16_t i = 0; i < 256; i++) {
+      brightnessTable[i] = exact(i << 8, depth);
+    }
+    brightnessTableDepth = depth;
+  }
+#endif
+  _table = brightnessTable;
+}
+
+RainbowTable::RainbowTable(uint8_t sat) : _sat(sat) {
+#if NUM_PIXELS >= 256
+  if (rainbowTable == nullptr) {
+    rainbowTable = static_cast<CRGB*>(malloc(sizeof(CRGB) * 256));
+    if (rainbowTable != nullptr) {
+      rainbowTableSat = ~sat; // so that it is built below
+    }
+  }
+  if ((rainbowTable != nullptr) && (sat != rainbowTableSat)) {
+    for (uint16_t hue = 0; hue < 256; hue++) {
+      hsv2rgb_rainbow(CHSV(hue, sat, 255), rainbowTable[hue]);
+    }
+    rainbowTableSat = sat;
+  }
+#endif
+  _table = rainbowTable;
+}
+
+void releaseWaveTables() {
+  free(brightnessTable);
+  brightnessTable = nullptr;
+  free(rainbowTable);
+  rainbowTable = nullptr;
+}
@@ -0,0 +1,73 @@
+/*
+   ESP8266 FastLED WebServer: https://github.com/jasoncoon/esp8266-fastled-webserver
+   Copyright (C) Jason Coon
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "common.h"
+
+#if EMBED_WEB_ASSETS
+
+// When this is missing, run: python3 pio-scripts/embed-web-assets.py
+#include "include/generated/WebAssets.h"
+
+static bool findWebAsset(const char* path, WebAsset& found) {
+  uint16_t low = 0;
+  uint16_t high = WEB_ASSET_COUNT;
+  while (low < high) {
+    const uint16_t middle = (low + high) / 2;
+    WebAsset asset;
+    memcpy_P(&asset, &webAssets[middle], sizeof(asset));
+    const int order = strcmp_P(path, webAssetPaths + asset.pathOffset);
+    if (order > 0) {
+      low = middle + 1;
+    } else if (order < 0) {
+      high = middle;
+    } else {
+      found = asset;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool serveWebAsset(const String& path) {
+  WebAsset asset;
+  if (!findWebAsset(path.c_str(), asset)) {
+    return false;
+  }
+  if (sendNotModified(formatETag(asset.hash, asset.size))) {
+    return true;
+  }
+
+  const uint32_t start = micros();
+  const bool download = webServer.hasArg("download");
+  if (asset.gzipped && !download) {
+    webServer.sendHeader("Content-Encoding", "gzip");
+  }
+  webServer.setContentLength(asset.size);
+  webServer.send(200, getContentType(path), ""); // application/octet-stream for a download
+  // write_P() copies from flash into the TCP send buffers as they free up,
+  // without an intermediate copy in RAM; the first chunk now, the rest between frames
+  transferFlash(reinterpret_cast<PGM_P>(webAssetData + asset.offset), asset.size);
+  LOG_DEBUG("%s: %u bytes from flash, first chunk in %lu us", path.c_str(), (unsigned)asset.size, (unsigned long)(micros() - start));
+  return true;
+}
+
+uint16_t webAssetCount() {
+  return WEB_ASSET_COUNT;
+}
+
+#endif // EMBED_WEB_ASSETS
@@ -20,67 +20,33 @@
 
 #if defined(ENABLE_IR)
 
-IRrecv irReceiver(RECV_PIN);
-
-enum class InputCommand {
-  None,
-  Up,
-  Down,
-  Left,
-  Right,
-  Select,
-  Brightness,
-  PlayMode,
-  Palette,
-  Power,
-  BrightnessUp,
-  BrightnessDown,
-
-  Pattern1,
-  Pattern2,
-  Pattern3,
-  Pattern4,
-  Pattern5,
-  Pattern6,
-  Pattern7,
-  Pattern8,
-  Pattern9,
-  Pattern10,
-  Pattern11,
-  Pattern12,
-
-  RedUp,
-  RedDown,
-  GreenUp,
-  GreenDown,
-  BlueUp,
-  BlueDown,
-
-  Red,
-  RedOrange,
-  Orange,
-  YellowOrange,
-  Yellow,
-
-  Green,
-  Lime,
-  Aqua,
-  Teal,
-  Navy,
-
-  Blue,
-  RoyalBlue,
-  Purple,
-  Indigo,
-  Magenta,
-
-  White,
-  Pink,
-  LightPink,
-  BabyBlue,
-  LightBlue,
+#include <algorithm>
+
+IRrecv irReceiver(IR_RECV_PIN);
+
+// The names are also the command names used in IR_REMOTES_FILE_PATH
+#define INPUT_COMMANDS(X) \
+  X(None) X(Up) X(Down) X(Left) X(Right) X(Select) X(Brightness) X(PlayMode) X(Palette) X(Power) \
+  X(BrightnessUp) X(BrightnessDown) \
+  X(Pattern1) X(Pattern2) X(Pattern3) X(Pattern4) X(Pattern5) X(Pattern6) \
+  X(Pattern7) X(Pattern8) X(Pattern9) X(Pattern10) X(Pattern11) X(Pattern12) \
+  X(RedUp) X(RedDown) X(GreenUp) X(GreenDown) X(BlueUp) X(BlueDown) \
+  X(Red) X(RedOrange) X(Orange) X(YellowOrange) X(Yellow) \
+  X(Green) X(Lime) X(Aqua) X(Teal) X(Navy) \
+  X(Blue) X(RoyalBlue) X(Purple) X(Indigo) X(Magenta) \
+  X(White) X(Pink) X(LightPink) X(BabyBlue) X(LightBlue) \
+  X(Repeat) /* the code a remote sends while any key is held */
+
+#define INPUT_COMMAND_ENUM(name) name,
+#define INPUT_COMMAND_NAME(name) #name "\0"
+
+enum class InputCommand : uint8_t {
+  INPUT_COMMANDS(INPUT_COMMAND_ENUM)
 };
 
+// "None\0Up\0Down\0...", in enum order
+static const char inputCommandNames[] PROGMEM = INPUT_COMMANDS(INPUT_COMMAND_NAME);
+
 #if 1 // collapse IR codes
   // IR Raw Key Codes for SparkFun remote
   #define IRCODE_SPARKFUN_POWER  0x10EFD827 // 284153895
@@ -177,303 +143,288 @@ enum class InputCommand {
 #endif
 
 
-bool sparkfunRemoteEnabled = true;
-bool adafruitRemoteEnabled = true;
-bool etopxizuRemoteEnabled = true;
-
-// Low level IR code reading function
-// Function will return 0 if no IR code available
-unsigned long decodeIRCode() {
-
-  decode_results results;
 
-  results.value = 0;
+struct IrKey {
+  uint32_t code;
+  InputCommand command;
+};
 
-  // Attempt to read an IR code ?
-  if (irReceiver.decode(&results)) {
-    delay(20);
+// Each remote's keys, sorted by code for binary search (enforced below)
+static constexpr IrKey sparkfunKeys[] PROGMEM = {
+  { IRCODE_SPARKFUN_DOWN,   InputCommand::Down       },
+  { IRCODE_SPARKFUN_LEFT,   InputCommand::Left       },
+  { IRCODE_SPARKFUN_SELECT, InputCommand::Select     },
+  { IRCODE_SPARKFUN_B,      InputCommand::Palette    },
+  { IRCODE_SPARKFUN_RIGHT,  InputCommand::Right      },
+  { IRCODE_SPARKFUN_UP,     InputCommand::Up         },
+  { IRCODE_SPARKFUN_POWER,  InputCommand::Brightness },
+  { IRCODE_SPARKFUN_A,      InputCommand::PlayMode   },
+  { IRCODE_SPARKFUN_HELD,   InputCommand::Repeat     },
+};
 
-    if (results.value != 0)
-      Serial.println(results.value);
+static constexpr IrKey adafruitKeys[] PROGMEM = {
+  { IRCODE_ADAFRUIT_VOLUME_DOWN, InputCommand::BrightnessDown },
+  { IRCODE_ADAFRUIT_1,           InputCommand::PlayMode       },
+  { IRCODE_ADAFRUIT_LEFT,        InputCommand::Left           },
+  { IRCODE_ADAFRUIT_VOLUME_UP,   InputCommand::BrightnessUp   },
+  { IRCODE_ADAFRUIT_RIGHT,       InputCommand::Right          },
+  { IRCODE_ADAFRUIT_STOP_MODE,   InputCommand::PlayMode       },
+  { IRCODE_ADAFRUIT_PLAY_PAUSE,  InputCommand::Power          },
+  { IRCODE_ADAFRUIT_2,           InputCommand::Palette        },
+  { IRCODE_ADAFRUIT_ENTER_SAVE,  InputCommand::Select         },
+  { IRCODE_ADAFRUIT_UP,          InputCommand::Up             },
+  { IRCODE_ADAFRUIT_DOWN,        InputCommand::Down           },
+  { IRCODE_ADAFRUIT_HELD,        InputCommand::Repeat         },
+};
 
-    // Prepare to receive the next IR code
-    irReceiver.resume();
-  }
+static constexpr IrKey etopxizuKeys[] PROGMEM = {
+  { IRCODE_ETOPXIZU_POWER,           InputCommand::Power          },
+  { IRCODE_ETOPXIZU_RED_DOWN,        InputCommand::RedDown        },
+  { IRCODE_ETOPXIZU_ORANGE,          InputCommand::Orange         },
+  { IRCODE_ETOPXIZU_DIY4,            InputCommand::Pattern4       },
+  { IRCODE_ETOPXIZU_PINK,            InputCommand::Pink           },
+  { IRCODE_ETOPXIZU_YELLOW,          InputCommand::Yellow         },
+  { IRCODE_ETOPXIZU_RED,             InputCommand::Red            },
+  { IRCODE_ETOPXIZU_JUMP3,           InputCommand::Pattern7       },
+  { IRCODE_ETOPXIZU_WHITE,           InputCommand::White          },
+  { IRCODE_ETOPXIZU_RED_UP,          InputCommand::RedUp          },
+  { IRCODE_ETOPXIZU_RED_ORANGE,      InputCommand::RedOrange      },
+  { IRCODE_ETOPXIZU_DIY1,            InputCommand::Pattern1       },
+  { IRCODE_ETOPXIZU_LIGHT_PINK,      InputCommand::LightPink      },
+  { IRCODE_ETOPXIZU_YELLOW_ORANGE,   InputCommand::YellowOrange   },
+  { IRCODE_ETOPXIZU_BRIGHTNESS_UP,   InputCommand::BrightnessUp   },
+  { IRCODE_ETOPXIZU_BLUE_DOWN,       InputCommand::BlueDown       },
+  { IRCODE_ETOPXIZU_DIY6,            InputCommand::Pattern6       },
+  { IRCODE_ETOPXIZU_MAGENTA,         InputCommand::Magenta        },
+  { IRCODE_ETOPXIZU_FADE3,           InputCommand::Pattern9       },
+  { IRCODE_ETOPXIZU_BLUE_UP,         InputCommand::BlueUp         },
+  { IRCODE_ETOPXIZU_DIY3,            InputCommand::Pattern3       },
+  { IRCODE_ETOPXIZU_INDIGO,          InputCommand::Indigo         },
+  { IRCODE_ETOPXIZU_PLAY_PAUSE,      InputCommand::PlayMode       },
+  { IRCODE_ETOPXIZU_GREEN_DOWN,      InputCommand::GreenDown      },
+  { IRCODE_ETOPXIZU_AQUA,            InputCommand::Aqua           },
+  { IRCODE_ETOPXIZU_DIY5,            InputCommand::Pattern5       },
+  { IRCODE_ETOPXIZU_ROYAL_BLUE,      InputCommand::RoyalBlue      },
+  { IRCODE_ETOPXIZU_NAVY,            InputCommand::Navy           },
+  { IRCODE_ETOPXIZU_GREEN,           InputCommand::Green          },
+  { IRCODE_ETOPXIZU_JUMP7,           InputCommand::Pattern8       },
+  { IRCODE_ETOPXIZU_BLUE,            InputCommand::Blue           },
+  { IRCODE_ETOPXIZU_GREEN_UP,        InputCommand::GreenUp        },
+  { IRCODE_ETOPXIZU_LIME,            InputCommand::Lime           },
+  { IRCODE_ETOPXIZU_DIY2,            InputCommand::Pattern2       },
+  { IRCODE_ETOPXIZU_PURPLE,          InputCommand::Purple         },
+  { IRCODE_ETOPXIZU_TEAL,            InputCommand::Teal           },
+  { IRCODE_ETOPXIZU_BRIGHTNESS_DOWN, InputCommand::BrightnessDown },
+  { IRCODE_ETOPXIZU_SLOW,            InputCommand::Down           },
+  { IRCODE_ETOPXIZU_FLASH,           InputCommand::Pattern11      },
+  { IRCODE_ETOPXIZU_LIGHT_BLUE,      InputCommand::LightBlue      },
+  { IRCODE_ETOPXIZU_FADE7,           InputCommand::Pattern10      },
+  { IRCODE_ETOPXIZU_QUICK,           InputCommand::Up             },
+  { IRCODE_ETOPXIZU_AUTO,            InputCommand::Pattern12      },
+  { IRCODE_ETOPXIZU_BABY_BLUE,       InputCommand::BabyBlue       },
+  { IRCODE_ETOPXIZU_HELD,            InputCommand::Repeat         },
+};
 
-  return results.value;
+template <size_t N>
+constexpr bool sortedByCode(const IrKey (&keys)[N], size_t i = 1) {
+  return (i >= N) || ((keys[i - 1].code < keys[i].code) && sortedByCode(keys, i + 1));
 }
+static_assert(sortedByCode(sparkfunKeys), "sparkfunKeys must be sorted by code");
+static_assert(sortedByCode(adafruitKeys), "adafruitKeys must be sorted by code");
+static_assert(sortedByCode(etopxizuKeys), "etopxizuKeys must be sorted by code");
 
-// Read an IR code
-// Function will return 0 if no IR code available
-unsigned long readIRCode() {
+bool sparkfunRemoteEnabled = true;
+bool adafruitRemoteEnabled = true;
+bool etopxizuRemoteEnabled = true;
 
-  // Is there an IR code to read ?
-  unsigned long code = decodeIRCode();
-  if (code == 0) {
-    // No code so return 0
-    return 0;
+// keys loaded from IR_REMOTES_FILE_PATH, sorted by code, in RAM
+static IrKey* fileKeys = nullptr;
+static uint16_t fileKeyCount = 0;
+
+static bool findKey(const IrKey* keys, uint16_t count, bool inProgmem, uint32_t code, InputCommand& command) {
+  uint16_t low = 0;
+  uint16_t high = count;
+  while (low < high) {
+    const uint16_t middle = (low + high) / 2;
+    IrKey key;
+    if (inProgmem) {
+      memcpy_P(&key, &keys[middle], sizeof(key));
+    } else {
+      key = keys[middle];
+    }
+    if (key.code < code) {
+      low = middle + 1;
+    } else if (key.code > code) {
+      high = middle;
+    } else {
+      command = key.command;
+      return true;
+    }
   }
+  return false;
+}
 
-  // Keep reading until code changes
-  while (decodeIRCode() == code) {
-    ;
+// The remotes file takes precedence, then the built-in remotes, in their original order
+static InputCommand getCommand(uint32_t code) {
+  InputCommand command = InputCommand::None;
+  if (findKey(fileKeys, fileKeyCount, false, code, command)) {
+    return command;
+  }
+  if (adafruitRemoteEnabled && findKey(adafruitKeys, ARRAY_SIZE2(adafruitKeys), true, code, command)) {
+    return command;
+  }
+  if (sparkfunRemoteEnabled && findKey(sparkfunKeys, ARRAY_SIZE2(sparkfunKeys), true, code, command)) {
+    return command;
   }
-  // Serial.println(code);
-  return code;
+  if (etopxizuRemoteEnabled && findKey(etopxizuKeys, ARRAY_SIZE2(etopxizuKeys), true, code, command)) {
+    return command;
+  }
+  return InputCommand::None;
 }
 
-unsigned long lastIrCode = 0;
-
-unsigned int holdStartTime = 0;
-// unsigned int defaultHoldDelay = 500;
-bool isHolding = false;
-
-unsigned int zeroStartTime = 0;
-unsigned int zeroDelay = 120;
-
-unsigned long readIRCode(unsigned int holdDelay) {
-  // read the raw code from the sensor
-  unsigned long irCode = readIRCode();
-
-  //Serial.print(millis());
-  //Serial.print("\t");
-  //Serial.println(irCode);
-
-  // don't return a short click until we know it's not a long hold
-  // we'll have to wait for holdDelay ms to pass before returning a non-zero IR code
-  // then, after that delay, as long as the button is held, we can keep returning the code
-  // every time until it's released
-
-  // the ir remote only sends codes every 107 ms or so (avg 106.875, max 111, min 102),
-  // so the ir sensor will return 0 even if a button is held
-  // so we have to wait longer than that before returning a non-zero code
-  // in order to detect that a button has been released and is no longer held
-
-  // only reset after we've gotten 0 back for more than the ir remote send interval
-  unsigned int zeroTime = 0;
-
-  if (irCode == 0) {
-    zeroTime = millis() - zeroStartTime;
-    if (zeroTime >= zeroDelay && lastIrCode != 0) {
-      //Serial.println(F("zero delay has elapsed, returning last ir code"));
-      // the button has been released for longer than the zero delay
-      // start over delays over and return the last code
-      irCode = lastIrCode;
-      lastIrCode = 0;
-      return irCode;
-    }
-
-    return 0;
+// Remotes resend a code (or their held code) about every 108 ms while a key is
+// held, so a gap longer than IR_RELEASE_MILLIS means the key was released.
+// Only the adjustment keys repeat, once held for IR_HOLD_MILLIS.
+static const uint32_t IR_RELEASE_MILLIS = 150;
+static const uint32_t IR_HOLD_MILLIS    = 500;
+
+static InputCommand heldCommand = InputCommand::None;
+static uint32_t heldSinceMillis = 0;
+static uint32_t lastCodeMillis = 0;
+
+static bool repeatsWhileHeld(InputCommand command) {
+  switch (command) {
+    case InputCommand::BrightnessUp:
+    case InputCommand::BrightnessDown:
+    case InputCommand::RedUp:
+    case InputCommand::RedDown:
+    case InputCommand::GreenUp:
+    case InputCommand::GreenDown:
+    case InputCommand::BlueUp:
+    case InputCommand::BlueDown:
+      return true;
+    default:
+      return false;
   }
+}
 
-  // reset the zero timer every time a non-zero code is read
-  zeroStartTime = millis();
-
-  unsigned int heldTime = 0;
-
-  if (irCode == IRCODE_SPARKFUN_HELD || irCode == IRCODE_ADAFRUIT_HELD) {
-    // has the hold delay passed?
-    heldTime = millis() - holdStartTime;
-    if (heldTime >= holdDelay) {
-      isHolding = true;
-      //Serial.println(F("hold delay has elapsed, returning last ir code"));
-      return lastIrCode;
-    }
-    else if (holdStartTime == 0) {
-      isHolding = false;
-      holdStartTime = millis();
+// Returns the command for a newly pressed key, or for a held key that repeats;
+// otherwise InputCommand::None.  Never waits for the receiver.
+static InputCommand readCommand() {
+  decode_results results;
+  if (!irReceiver.decode(&results)) {
+    return InputCommand::None;
+  }
+  // Prepare to receive the next IR code
+  irReceiver.resume();
+
+  const uint32_t now = millis();
+  const uint32_t code = results.value;
+  InputCommand command = getCommand(code);
+  const bool held =
+    (heldCommand != InputCommand::None) &&
+    (now - lastCodeMillis < IR_RELEASE_MILLIS) &&
+    (results.repeat || (command == InputCommand::Repeat) || (command == heldCommand));
+  lastCodeMillis = now;
+
+  if (held) {
+    if (repeatsWhileHeld(heldCommand) && (now - heldSinceMillis >= IR_HOLD_MILLIS)) {
+      return heldCommand;
     }
+    return InputCommand::None;
   }
-  else {
-    // not zero, not IRCODE_SPARKFUN_HELD
-    // store it for use later, until the hold and zero delays have elapsed
-    holdStartTime = millis();
-    isHolding = false;
-    lastIrCode = irCode;
-    return 0;
+  if (command == InputCommand::Repeat) {
+    // held code for a key pressed before the last release; ignore
+    return InputCommand::None;
   }
-
-  return 0;
+  if (command == InputCommand::None) {
+    LOG_INFO("IR code 0x%08X: no command", (unsigned)code);
+  }
+  heldCommand = command;
+  heldSinceMillis = now;
+  return command;
 }
 
-InputCommand getCommand(unsigned long input) {
-  if (adafruitRemoteEnabled) {
-    switch (input) {
-      case IRCODE_ADAFRUIT_UP:
-        return InputCommand::Up;
-
-      case IRCODE_ADAFRUIT_DOWN:
-        return InputCommand::Down;
-
-      case IRCODE_ADAFRUIT_LEFT:
-        return InputCommand::Left;
-
-      case IRCODE_ADAFRUIT_RIGHT:
-        return InputCommand::Right;
-
-      case IRCODE_ADAFRUIT_ENTER_SAVE:
-        return InputCommand::Select;
-
-      case IRCODE_ADAFRUIT_STOP_MODE:
-      case IRCODE_ADAFRUIT_1:
-        return InputCommand::PlayMode;
-
-      case IRCODE_ADAFRUIT_2:
-        return InputCommand::Palette;
-
-      case IRCODE_ADAFRUIT_PLAY_PAUSE:
-        return InputCommand::Power;
-
-      case IRCODE_ADAFRUIT_VOLUME_UP:
-        return InputCommand::BrightnessUp;
-
-      case IRCODE_ADAFRUIT_VOLUME_DOWN:
-        return InputCommand::BrightnessDown;
+static bool parseInputCommand(const char* name, InputCommand& command) {
+  const char* candidate = inputCommandNames;
+  for (uint8_t i = 0; i <= static_cast<uint8_t>(InputCommand::Repeat); i++) {
+    if (strcmp_P(name, candidate) == 0) {
+      command = static_cast<InputCommand>(i);
+      return true;
     }
+    candidate += strlen_P(candidate) + 1;
   }
+  return false;
+}
 
-  if (sparkfunRemoteEnabled) {
-    switch (input) {
-      case IRCODE_SPARKFUN_UP:
-        return InputCommand::Up;
-
-      case IRCODE_SPARKFUN_DOWN:
-        return InputCommand::Down;
-
-      case IRCODE_SPARKFUN_LEFT:
-        return InputCommand::Left;
-
-      case IRCODE_SPARKFUN_RIGHT:
-        return InputCommand::Right;
-
-      case IRCODE_SPARKFUN_SELECT:
-        return InputCommand::Select;
-
-      case IRCODE_SPARKFUN_POWER:
-        return InputCommand::Brightness;
+// One key per line, "<code> <command>", e.g. "0x00FF629D BrightnessUp"; '#' starts a comment.
+// Returns false for blank lines and lines that are not a key.
+static bool parseIrKey(String& line, IrKey& key) {
+  const int comment = line.indexOf('#');
+  if (comment >= 0) {
+    line.remove(comment);
+  }
+  line.trim();
+  if (line.length() == 0) {
+    return false;
+  }
+  char* end = nullptr;
+  key.code = strtoul(line.c_str(), &end, 0);
+  if (end == line.c_str()) {
+    return false;
+  }
+  while ((*end == ' ') || (*end == '\t')) {
+    end++;
+  }
+  return parseInputCommand(end, key.command) && (key.command != InputCommand::None);
+}
 
-      case IRCODE_SPARKFUN_A:
-        return InputCommand::PlayMode;
+bool loadIrRemotes(const char* path) {
+  if (fileKeys != nullptr) {
+    return true;
+  }
+  if (!MYFS.exists(path)) {
+    return false;
+  }
+  File file = MYFS.open(path, "r");
+  if (!file) {
+    return false;
+  }
 
-      case IRCODE_SPARKFUN_B:
-        return InputCommand::Palette;
-    }
+  // the line count bounds the number of keys
+  uint16_t lineCount = 0;
+  while (file.available()) {
+    file.readStringUntil('\n');
+    lineCount++;
+  }
+  IrKey* keys = static_cast<IrKey*>(malloc(lineCount * sizeof(IrKey)));
+  if (keys == nullptr) {
+    file.close();
+    LOG_WARN("IR remotes %s ignored: not enough memory", path);
+    return false;
   }
 
-  if (etopxizuRemoteEnabled) {
-    switch (input) {
-      case IRCODE_ETOPXIZU_QUICK:
-        return InputCommand::Up;
-
-      case IRCODE_ETOPXIZU_SLOW:
-        return InputCommand::Down;
-
-      case IRCODE_ETOPXIZU_PLAY_PAUSE:
-        return InputCommand::PlayMode;
-
-      case IRCODE_ETOPXIZU_POWER:
-        return InputCommand::Power;
-
-      case IRCODE_ETOPXIZU_BRIGHTNESS_UP:
-        return InputCommand::BrightnessUp;
-      case IRCODE_ETOPXIZU_BRIGHTNESS_DOWN:
-        return InputCommand::BrightnessDown;
-
-      case IRCODE_ETOPXIZU_DIY1:
-        return InputCommand::Pattern1;
-      case IRCODE_ETOPXIZU_DIY2:
-        return InputCommand::Pattern2;
-      case IRCODE_ETOPXIZU_DIY3:
-        return InputCommand::Pattern3;
-      case IRCODE_ETOPXIZU_DIY4:
-        return InputCommand::Pattern4;
-      case IRCODE_ETOPXIZU_DIY5:
-        return InputCommand::Pattern5;
-      case IRCODE_ETOPXIZU_DIY6:
-        return InputCommand::Pattern6;
-      case IRCODE_ETOPXIZU_JUMP3:
-        return InputCommand::Pattern7;
-      case IRCODE_ETOPXIZU_JUMP7:
-        return InputCommand::Pattern8;
-      case IRCODE_ETOPXIZU_FADE3:
-        return InputCommand::Pattern9;
-      case IRCODE_ETOPXIZU_FADE7:
-        return InputCommand::Pattern10;
-      case IRCODE_ETOPXIZU_FLASH:
-        return InputCommand::Pattern11;
-      case IRCODE_ETOPXIZU_AUTO:
-        return InputCommand::Pattern12;
-
-      case IRCODE_ETOPXIZU_RED_UP:
-        return InputCommand::RedUp;
-      case IRCODE_ETOPXIZU_RED_DOWN:
-        return InputCommand::RedDown;
-
-      case IRCODE_ETOPXIZU_GREEN_UP:
-        return InputCommand::GreenUp;
-      case IRCODE_ETOPXIZU_GREEN_DOWN:
-        return InputCommand::GreenDown;
-
-      case IRCODE_ETOPXIZU_BLUE_UP:
-        return InputCommand::BlueUp;
-      case IRCODE_ETOPXIZU_BLUE_DOWN:
-        return InputCommand::BlueDown;
-
-      case IRCODE_ETOPXIZU_RED:
-        return InputCommand::Red;
-      case IRCODE_ETOPXIZU_RED_ORANGE:
-        return InputCommand::RedOrange;
-      case IRCODE_ETOPXIZU_ORANGE:
-        return InputCommand::Orange;
-      case IRCODE_ETOPXIZU_YELLOW_ORANGE:
-        return InputCommand::YellowOrange;
-      case IRCODE_ETOPXIZU_YELLOW:
-        return InputCommand::Yellow;
-
-      case IRCODE_ETOPXIZU_GREEN:
-        return InputCommand::Green;
-      case IRCODE_ETOPXIZU_LIME:
-        return InputCommand::Lime;
-      case IRCODE_ETOPXIZU_AQUA:
-        return InputCommand::Aqua;
-      case IRCODE_ETOPXIZU_TEAL:
-        return InputCommand::Teal;
-      case IRCODE_ETOPXIZU_NAVY:
-        return InputCommand::Navy;
-
-      case IRCODE_ETOPXIZU_BLUE:
-        return InputCommand::Blue;
-      case IRCODE_ETOPXIZU_ROYAL_BLUE:
-        return InputCommand::RoyalBlue;
-      case IRCODE_ETOPXIZU_PURPLE:
-        return InputCommand::Purple;
-      case IRCODE_ETOPXIZU_INDIGO:
-        return InputCommand::Indigo;
-      case IRCODE_ETOPXIZU_MAGENTA:
-        return InputCommand::Magenta;
-
-      case IRCODE_ETOPXIZU_WHITE:
-        return InputCommand::White;
-      case IRCODE_ETOPXIZU_PINK:
-        return InputCommand::Pink;
-      case IRCODE_ETOPXIZU_LIGHT_PINK:
-        return InputCommand::LightPink;
-      case IRCODE_ETOPXIZU_BABY_BLUE:
-        return InputCommand::BabyBlue;
-      case IRCODE_ETOPXIZU_LIGHT_BLUE:
-        return InputCommand::LightBlue;
+  file.seek(0);
+  uint16_t count = 0;
+  for (uint16_t lineNumber = 1; file.available() && (count < lineCount); lineNumber++) {
+    String line = file.readStringUntil('\n');
+    if (parseIrKey(line, keys[count])) {
+      count++;
+    } else if (line.length() != 0) {
+      LOG_WARN("IR remotes %s, line %u ignored: %s", path, lineNumber, line.c_str());
     }
   }
+  file.close();
 
-  return InputCommand::None;
-}
-
-InputCommand readCommand() {
-  return getCommand(readIRCode());
-}
-
-InputCommand readCommand(unsigned int holdDelay) {
-  return getCommand(readIRCode(holdDelay));
+  if (count == 0) {
+    free(keys);
+    return false;
+  }
+  std::sort(keys, keys + count, [](const IrKey& a, const IrKey& b) { return a.code < b.code; });
+  fileKeys = keys;
+  fileKeyCount = count;
+  LOG_INFO("IR remotes %s loaded: %u keys", path, count);
+  return true;
 }
 
 void handleIrInput()
@@ -481,8 +432,8 @@ void handleIrInput()
  InputCommand command = readCommand();
 
  if (command != InputCommand::None) {
-   Serial.print("command: ");
-   Serial.println((int) command);
+   LOG_DEBUG("command: %d", (int) command);
+   governorWake();
  }
 
  switch (command) {
@@ -680,6 +631,9 @@ void handleIrInput()
        setSolidColor(CRGB::LightBlue);
        break;
      }
+
+   default:
+     break;
  }
 }
 
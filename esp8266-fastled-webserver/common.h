@@ -19,6 +19,12 @@
 #if !defined(ESP8266_FASTLED_WEBSERVER_COMMON_H)
 #define ESP8266_FASTLED_WEBSERVER_COMMON_H
 
+#if defined(HOST_UNIT_TEST)
+  // Host unit tests (test/, pio test -e native) build single source files
+  // against stand-ins for the Arduino core, FastLED and the product config.
+  #include "../test/host/host_common.h"
+#else
+
 #include "Arduino.h"
 
 // config.h must be included before FastLED, as it may define FastLED options
@@ -33,13 +39,13 @@
   #include "ArduinoJson.h"
 
   #define FASTLED_INTERNAL // no other way to suppress build warnings
+  #define USE_GET_MILLISECOND_TIMER 1 // GET_MILLIS() returns the frame time, see get_millisecond_timer()
   #include <FastLED.h>
   FASTLED_USING_NAMESPACE
 
   #include <LittleFS.h>
   #define MYFS LittleFS
 
-  #include <NTPClient.h>
   #include <ESP8266WiFi.h>
   #include <WiFiUdp.h>
   #include <ESP8266mDNS.h>
@@ -54,6 +60,9 @@
   #include "./include/simplehacks/static_eval.h"
   #include "./include/simplehacks/constexpr_strlen.h"
   #include "./include/simplehacks/array_size2.h"
+  #include "./include/ParameterSnapshot.hpp"
+  #include "./include/MapTable.hpp"
+  #include "./include/Log.hpp"
 #endif // 1
 
 void dimAll(byte value);
@@ -62,58 +71,7 @@ String WiFi_SSID(bool persistent);
 String getInfoJson();
 
 
-// Ugly macro-like constexpr, used for FastLED template arguments
-template <size_t ONE_BASED_OUTPUT_CHANNEL>
-constexpr int LedOffset() {
-  static_assert(ONE_BASED_OUTPUT_CHANNEL <= PARALLEL_OUTPUT_CHANNELS, "");
-  static_assert(ONE_BASED_OUTPUT_CHANNEL >= 1, "");
-  return 0 // this would be much simpler with C++14
-  #if PARALLEL_OUTPUT_CHANNELS >= 2
-    + ((ONE_BASED_OUTPUT_CHANNEL >= 2) ? PIXELS_ON_DATA_PIN_1 : 0)
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 3
-    + ((ONE_BASED_OUTPUT_CHANNEL >= 3) ? PIXELS_ON_DATA_PIN_2 : 0)
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 4
-    + ((ONE_BASED_OUTPUT_CHANNEL >= 4) ? PIXELS_ON_DATA_PIN_3 : 0)
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 5
-    + ((ONE_BASED_OUTPUT_CHANNEL >= 5) ? PIXELS_ON_DATA_PIN_4 : 0)
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 6
-    + ((ONE_BASED_OUTPUT_CHANNEL >= 6) ? PIXELS_ON_DATA_PIN_5 : 0)
-  #endif
-  ;
-}
-template <size_t ONE_BASED_OUTPUT_CHANNEL>
-constexpr int LedCount() {
-  static_assert(ONE_BASED_OUTPUT_CHANNEL <= PARALLEL_OUTPUT_CHANNELS, "");
-  static_assert(ONE_BASED_OUTPUT_CHANNEL >= 1, "");
-  #if PARALLEL_OUTPUT_CHANNELS == 1
-    return NUM_PIXELS;
-  #else
-    return // this would be much simpler with C++14
-    #if PARALLEL_OUTPUT_CHANNELS >= 6
-      (ONE_BASED_OUTPUT_CHANNEL == 6) ? PIXELS_ON_DATA_PIN_6 :
-    #endif
-    #if PARALLEL_OUTPUT_CHANNELS >= 5
-      (ONE_BASED_OUTPUT_CHANNEL == 5) ? PIXELS_ON_DATA_PIN_5 :
-    #endif
-    #if PARALLEL_OUTPUT_CHANNELS >= 4
-      (ONE_BASED_OUTPUT_CHANNEL == 4) ? PIXELS_ON_DATA_PIN_4 :
-    #endif
-    #if PARALLEL_OUTPUT_CHANNELS >= 3
-      (ONE_BASED_OUTPUT_CHANNEL == 3) ? PIXELS_ON_DATA_PIN_3 :
-    #endif
-    #if PARALLEL_OUTPUT_CHANNELS >= 2
-      (ONE_BASED_OUTPUT_CHANNEL == 2) ? PIXELS_ON_DATA_PIN_2 :
-    #endif
-    #if PARALLEL_OUTPUT_CHANNELS >= 1
-      (ONE_BASED_OUTPUT_CHANNEL == 1) ? PIXELS_ON_DATA_PIN_1 :
-    #endif
-      0;
-  #endif
-}
+#include "include/ChannelLayout.hpp"
 
 void writeAndCommitSettings();
 void broadcastInt(String name, uint8_t value);
@@ -143,6 +101,28 @@ typedef struct {
   String name;
 } PaletteAndName;
 
+// Settings the renderer needs to be consistent for a whole frame.
+// Taken as a snapshot at the start of each frame (see acquireRenderParameters()).
+// Single-byte settings used only inside patterns (speed, cooling, ...) are
+// read directly, as a byte cannot be torn.
+typedef struct {
+  uint8_t power;
+  uint8_t brightness;
+  uint8_t currentPatternIndex;
+  uint8_t showClock;
+  CRGB    solidColor;
+} RenderParameters;
+
+void publishRenderParameters();
+const RenderParameters& acquireRenderParameters();
+const RenderParameters& renderParameters();
+void handleNetwork();
+void renderFrame();
+#if RENDER_TASK_ON_SEPARATE_CORE
+void networkTask(void*);
+void renderTask(void*);
+#endif
+
 
 // forward-declarations
 
@@ -200,54 +180,77 @@ extern uint8_t gCurrentPaletteNumber;
 
 extern WiFiManager wifiManager;
 extern ESP8266WebServer webServer;
-extern NTPClient timeClient;
 extern String nameString;
 extern int utcOffsetInSeconds;
 extern uint8_t utcOffsetIndex;
 
 extern CRGB leds[NUM_PIXELS];
 
-#if IS_FIBONACCI // actual data in map.h
+// The maps are in flash, read through MapTable (see include/MapTable.hpp); actual data in Map.cpp.
+// They are not const, as a layout file may replace them at boot (see include/LayoutFile.hpp).
+#if IS_FIBONACCI
   #if NUM_PIXELS > 256 // when more than 256 pixels, cannot store index in uint8_t....
-    extern const uint16_t physicalToFibonacci [NUM_PIXELS];
-    extern const uint16_t fibonacciToPhysical [NUM_PIXELS];
+    typedef uint16_t fibonacci_index_t;
   #else
-    extern const uint8_t physicalToFibonacci [NUM_PIXELS];
-    extern const uint8_t fibonacciToPhysical [NUM_PIXELS];
+    typedef uint8_t fibonacci_index_t;
   #endif
+  extern MapTable<fibonacci_index_t> physicalToFibonacci;
+  extern MapTable<fibonacci_index_t> fibonacciToPhysical;
 #elif defined(PRODUCT_KRAKEN64)
-  extern const uint8_t  body    [NUM_PIXELS];
+  extern MapTable<uint8_t> body;
+#elif defined(PRODUCT_1628_RINGS)
+  const uint8_t ringCount { 20 };           // Total Number of Rings. AdaFruit Disk has 10
+  const uint8_t lastRing { ringCount - 1 }; // for convenience
+  extern const uint16_t rings[ringCount][2]; // { first, last } pixel of each ring, INCLUSIVE
 #endif
 
 #if HAS_COORDINATE_MAP
-  extern const uint8_t coordsX        [NUM_PIXELS];
-  extern const uint8_t coordsY        [NUM_PIXELS];
-  extern const uint8_t angles         [NUM_PIXELS];
-  extern const uint8_t (&radiusProxy) [NUM_PIXELS];
+  extern MapTable<uint8_t> coordsX;
+  extern MapTable<uint8_t> coordsY;
+  extern MapTable<uint8_t> angles;
+  extern MapTable<uint8_t> radiusProxy;
 #endif
 
 #include "include/GradientPalettes.hpp"
 #include "include/Fields.hpp"
 #include "include/FSBrowser.hpp"
+#include "include/AssetIndex.hpp"
+#include "include/WebAssets.hpp"
+#include "include/Transfers.hpp"
+#include "include/ForkJoin.hpp"
+#include "include/PixelOrder.hpp"
+#include "include/SwarKernels.hpp"
+#include "include/WaveKernels.hpp"
+#include "include/LayoutFile.hpp"
+#include "include/EnergyGovernor.hpp"
+#include "include/NtpClock.hpp"
 
 // IR (commands.cpp)
+#define IR_REMOTES_FILE_PATH "/remotes.txt"
 #if defined(ENABLE_IR)
   #include <IRremoteESP8266.h>
   extern IRrecv irReceiver;
   void handleIrInput();
+  // Adds the keys of further remotes, from a text file of "<code> <command>" lines.
+  // Call once at boot, after the file system is mounted.
+  bool loadIrRemotes(const char* path = IR_REMOTES_FILE_PATH);
 #else
   inline void handleIrInput() {}
+  inline bool loadIrRemotes(const char* = IR_REMOTES_FILE_PATH) { return false; }
 #endif
 
 // ping.cpp
 void checkPingTimer();
 
 // effects
+// heatMap.cpp (fire and water)
+void heatMap(const CRGBPalette16& palette, bool up);
 // twinkles.cpp
 void cloudTwinkles();
 void rainbowTwinkles();
 void snowTwinkles();
 void incandescentTwinkles();
+void releaseTwinkleList(); // frees the list of lit pixels colortwinkles() builds
 // twinkleFox.cpp
 void redGreenWhiteTwinkles();
 void hollyTwinkles();
@@ -263,6 +266,7 @@ void lavaTwinkles();
 void fireTwinkles();
 void cloud2Twinkles();
 void oceanTwinkles();
+void releaseTwinkleFoxPixels(); // frees the per-pixel table drawTwinkles() builds (TWINKLEFOX_PIXEL_TABLE)
 // map.h -- only when product defines HAS_COORDINATE_MAP to be true
 #if HAS_COORDINATE_MAP
 void anglePalette();
@@ -277,7 +281,8 @@ void radiusPalette();
 void angleGradientPalette();
 void radiusGradientPalette();
 void drawAnalogClock();
-void antialiasPixelAR(uint8_t angle, uint8_t dAngle, uint8_t startRadius, uint8_t endRadius, CRGB color, CRGB leds[] = leds, int _NUM_PIXELS = NUM_PIXELS);
+void antialiasPixelAR(uint8_t angle, uint8_t dAngle, uint8_t startRadius, uint8_t endRadius, CRGB color, CRGB leds[] = leds);
+void releaseMapBuffers(); // frees the angle index and expanded palette, built on first use
 #endif
 // map.h -- only when product defines IS_FIBONACCI to be true
 #if IS_FIBONACCI
@@ -333,4 +338,6 @@ void colorWavesPlaygroundFibonacci();
 void fibonacciStars();
 #endif
 
+#endif // HOST_UNIT_TEST
+
 #endif // ESP8266_FASTLED_WEBSERVER_COMMON_H
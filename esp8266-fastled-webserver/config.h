@@ -47,8 +47,22 @@
 // ////////////////////////////////////////////////////////////////////////////////////////////////////
 // #define UTC_OFFSET_IN_SECONDS (-6L * 60L * 60L) // UTC-6 (East-coast US ... no DST support)
 // #define NTP_UPDATE_THROTTLE_MILLLISECONDS (5UL * 60UL * 60UL * 1000UL) // Ping NTP server no more than every 5 minutes
+// #define ENABLE_NTP 1                   // set the clock patterns' time from NTP_SERVER (0 == no NTP traffic; clocks show the time since boot)
+// #define NTP_SERVER "pool.ntp.org"
+// #define ENABLE_DISCOVERY 0             // opt-in: ping the discovery server every 10 minutes, while the pixels are idle (see Ping.cpp)
 //
-// TODO: add option to disable NTP altogether
+// #define RENDER_TASK_ON_SEPARATE_CORE 1 // ESP32 only: network on one core, rendering on the other (default on ESP32)
+// #define PARALLEL_OUTPUT_BLOCK 0        // ESP8266 only: send up to four equal channels at once, on GPIO 12 .. 15 (FastLED block-clockless)
+// #define PARALLEL_PIXEL_KERNELS 1       // ESP32 only: render large per-pixel patterns on both cores (default on ESP32)
+// #define SWAR_PIXEL_KERNELS 1           // fade / scale / blend whole pixel arrays four bytes at a time (0 == use FastLED per-pixel functions)
+// #define TWINKLEFOX_PIXEL_TABLE 1       // cache TwinkleFOX per-pixel clock offset / speed / salt (4 bytes of heap per pixel, while shown; default when NUM_PIXELS <= 1024)
+// #define LOGICAL_RENDER_BUFFER 1        // spiral / reversed patterns draw in order into a second buffer, permuted into leds[] in one pass (3 bytes per pixel; default when IS_FIBONACCI, on ESP32 only)
+// #define RUNTIME_LAYOUT_FILE 1          // at boot, replace the built-in coordinate maps with /layout.bin, when present (default when HAS_COORDINATE_MAP)
+// #define ENERGY_GOVERNOR 1              // sleep between frames, draw rarely while static or powered off, modem sleep when idle (0 == always FRAMES_PER_SECOND)
+// #define EMBED_WEB_ASSETS 0             // compile data/ into the firmware (pio-scripts/embed-web-assets.py), so the web app needs no LittleFS upload
+// #define TRANSFER_CHUNK_BYTES 1460      // most bytes of a static file sent at a time, between frames (see include/Transfers.hpp)
+// #define LOG_LEVEL LOG_LEVEL_INFO       // LOG_*() messages above this level compile to nothing (LOG_LEVEL_NONE, _ERROR, _WARN, _INFO or _DEBUG)
+// #define LOG_BUFFER_SIZE 2048           // bytes of RAM for the log ring buffer, a power of two (see include/Log.hpp; default 512 on ESP8266)
 
 // ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Include the configuration files for this build
@@ -99,6 +113,59 @@
     #if !defined(NTP_UPDATE_THROTTLE_MILLLISECONDS)
         #define NTP_UPDATE_THROTTLE_MILLLISECONDS (5UL * 60UL * 60UL * 1000UL) // Ping NTP server no more than every 5 minutes
     #endif
+    #if !defined(EMBED_WEB_ASSETS)
+        #define EMBED_WEB_ASSETS 0
+    #endif
+    #if !defined(TRANSFER_CHUNK_BYTES)
+        #define TRANSFER_CHUNK_BYTES 1460 // one TCP segment
+    #endif
+    #define LOG_LEVEL_NONE  0
+    #define LOG_LEVEL_ERROR 1
+    #define LOG_LEVEL_WARN  2
+    #define LOG_LEVEL_INFO  3
+    #define LOG_LEVEL_DEBUG 4
+    #if !defined(LOG_LEVEL)
+        #define LOG_LEVEL LOG_LEVEL_INFO
+    #endif
+    #if !defined(LOG_BUFFER_SIZE)
+        #if defined(ARDUINO_ARCH_ESP8266)
+            #define LOG_BUFFER_SIZE 512 // static DRAM is short on ESP8266
+        #else
+            #define LOG_BUFFER_SIZE 2048
+        #endif
+    #endif
+    #if !defined(ENABLE_NTP)
+        #define ENABLE_NTP 1
+    #endif
+    #if !defined(NTP_SERVER)
+        #define NTP_SERVER "pool.ntp.org"
+    #endif
+    #if !defined(ENABLE_DISCOVERY)
+        #define ENABLE_DISCOVERY 0
+    #endif
+    #if !defined(SWAR_PIXEL_KERNELS)
+        #define SWAR_PIXEL_KERNELS 1
+    #endif
+    #if !defined(TWINKLEFOX_PIXEL_TABLE)
+        #if (NUM_PIXELS <= 1024)
+            #define TWINKLEFOX_PIXEL_TABLE 1
+        #else
+            #define TWINKLEFOX_PIXEL_TABLE 0
+        #endif
+    #endif
+    #if !defined(LOGICAL_RENDER_BUFFER)
+        #if defined(ARDUINO_ARCH_ESP8266)
+            #define LOGICAL_RENDER_BUFFER 0 // opt-in: NUM_PIXELS * 3 bytes of static DRAM
+        #else
+            #define LOGICAL_RENDER_BUFFER IS_FIBONACCI
+        #endif
+    #endif
+    #if !defined(RUNTIME_LAYOUT_FILE)
+        #define RUNTIME_LAYOUT_FILE HAS_COORDINATE_MAP
+    #endif
+    #if !defined(ENERGY_GOVERNOR)
+        #define ENERGY_GOVERNOR 1
+    #endif
 #endif
 
 // ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -151,22 +218,75 @@
     #endif
     #if !defined(PARALLEL_OUTPUT_CHANNELS)
         #error "PARALLEL_OUTPUT_CHANNELS must be defined"
-    #elif (PARALLEL_OUTPUT_CHANNELS == 1)
-        // nothing to test here
-    #elif (PARALLEL_OUTPUT_CHANNELS == 4)
-        static_assert(NUM_PIXELS == (PIXELS_ON_DATA_PIN_1 + PIXELS_ON_DATA_PIN_2 + PIXELS_ON_DATA_PIN_3 + PIXELS_ON_DATA_PIN_4), "");
-    #elif (PARALLEL_OUTPUT_CHANNELS == 5)
-        static_assert(NUM_PIXELS == (PIXELS_ON_DATA_PIN_1 + PIXELS_ON_DATA_PIN_2 + PIXELS_ON_DATA_PIN_3 + PIXELS_ON_DATA_PIN_4 + PIXELS_ON_DATA_PIN_5), "");
-    #elif (PARALLEL_OUTPUT_CHANNELS == 6)
-        static_assert(NUM_PIXELS == (PIXELS_ON_DATA_PIN_1 + PIXELS_ON_DATA_PIN_2 + PIXELS_ON_DATA_PIN_3 + PIXELS_ON_DATA_PIN_4 + PIXELS_ON_DATA_PIN_5 + PIXELS_ON_DATA_PIN_6), "");
-    #else
-        #error "PARALLEL_OUTPUT_CHANNELS currently tested only with values 1, 4, or 6."
+    #elif (PARALLEL_OUTPUT_CHANNELS < 1) || (PARALLEL_OUTPUT_CHANNELS > 16)
+        #error "PARALLEL_OUTPUT_CHANNELS must be between 1 and 16 (controller may further limit this)"
+    #endif
+    // Sum of PIXELS_ON_DATA_PIN_n == NUM_PIXELS is validated in include/ChannelLayout.hpp
+    #if (PARALLEL_OUTPUT_BLOCK != 0) && (PARALLEL_OUTPUT_BLOCK != 1)
+        #error "PARALLEL_OUTPUT_BLOCK must be defined to zero or one"
+    #endif
+    #if PARALLEL_OUTPUT_BLOCK && !defined(ARDUINO_ARCH_ESP8266)
+        #error "PARALLEL_OUTPUT_BLOCK is only for ESP8266 (ESP32 already sends its channels concurrently)"
+    #endif
+    #if PARALLEL_OUTPUT_BLOCK && (PARALLEL_OUTPUT_CHANNELS < 2)
+        #error "PARALLEL_OUTPUT_BLOCK requires at least two PARALLEL_OUTPUT_CHANNELS"
+    #endif
+    #if !defined(RENDER_TASK_ON_SEPARATE_CORE) || ((RENDER_TASK_ON_SEPARATE_CORE != 0) && (RENDER_TASK_ON_SEPARATE_CORE != 1))
+        #error "RENDER_TASK_ON_SEPARATE_CORE must be defined to zero or one"
+    #endif
+    #if RENDER_TASK_ON_SEPARATE_CORE && !defined(ARDUINO_ARCH_ESP32)
+        #error "RENDER_TASK_ON_SEPARATE_CORE requires a dual-core controller (ESP32)"
+    #endif
+    #if RENDER_TASK_ON_SEPARATE_CORE && (NETWORK_TASK_CORE == RENDER_TASK_CORE)
+        #error "NETWORK_TASK_CORE and RENDER_TASK_CORE must differ"
+    #endif
+    #if !defined(PARALLEL_PIXEL_KERNELS) || ((PARALLEL_PIXEL_KERNELS != 0) && (PARALLEL_PIXEL_KERNELS != 1))
+        #error "PARALLEL_PIXEL_KERNELS must be defined to zero or one"
+    #endif
+    #if PARALLEL_PIXEL_KERNELS && !defined(ARDUINO_ARCH_ESP32)
+        #error "PARALLEL_PIXEL_KERNELS requires a dual-core controller (ESP32)"
+    #endif
+    #if (SWAR_PIXEL_KERNELS != 0) && (SWAR_PIXEL_KERNELS != 1)
+        #error "SWAR_PIXEL_KERNELS must be defined to zero or one"
+    #endif
+    #if (TWINKLEFOX_PIXEL_TABLE != 0) && (TWINKLEFOX_PIXEL_TABLE != 1)
+        #error "TWINKLEFOX_PIXEL_TABLE must be defined to zero or one"
+    #endif
+    #if (LOGICAL_RENDER_BUFFER != 0) && (LOGICAL_RENDER_BUFFER != 1)
+        #error "LOGICAL_RENDER_BUFFER must be defined to zero or one"
+    #endif
+    #if (RUNTIME_LAYOUT_FILE != 0) && (RUNTIME_LAYOUT_FILE != 1)
+        #error "RUNTIME_LAYOUT_FILE must be defined to zero or one"
+    #endif
+    #if RUNTIME_LAYOUT_FILE && !HAS_COORDINATE_MAP
+        #error "RUNTIME_LAYOUT_FILE requires a product with a coordinate map (HAS_COORDINATE_MAP)"
+    #endif
+    #if (ENERGY_GOVERNOR != 0) && (ENERGY_GOVERNOR != 1)
+        #error "ENERGY_GOVERNOR must be defined to zero or one"
     #endif
     #if (UTC_OFFSET_IN_SECONDS < (-14L * 60L * 60L))
         #error "UTC_OFFSET_IN_SECONDS offset does not appear correct (< -14H) ... Note it is defined in seconds."
     #elif (UTC_OFFSET_IN_SECONDS > (14L * 60L * 60L))
         #error "UTC_OFFSET_IN_SECONDS offset does not appear correct (> +14H) ... Note it is defined in seconds."
     #endif
+    #if (EMBED_WEB_ASSETS != 0) && (EMBED_WEB_ASSETS != 1)
+        #error "EMBED_WEB_ASSETS must be defined to zero or one"
+    #endif
+    #if (TRANSFER_CHUNK_BYTES < 256) || (TRANSFER_CHUNK_BYTES > 8192)
+        #error "TRANSFER_CHUNK_BYTES must be between 256 and 8192"
+    #endif
+    #if (LOG_LEVEL < LOG_LEVEL_NONE) || (LOG_LEVEL > LOG_LEVEL_DEBUG)
+        #error "LOG_LEVEL must be one of LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_WARN, LOG_LEVEL_INFO or LOG_LEVEL_DEBUG"
+    #endif
+    #if (LOG_BUFFER_SIZE < 256) || ((LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) != 0)
+        #error "LOG_BUFFER_SIZE must be a power of two, at least 256"
+    #endif
+    #if (ENABLE_NTP != 0) && (ENABLE_NTP != 1)
+        #error "ENABLE_NTP must be defined to zero or one"
+    #endif
+    #if (ENABLE_DISCOVERY != 0) && (ENABLE_DISCOVERY != 1)
+        #error "ENABLE_DISCOVERY must be defined to zero or one"
+    #endif
     #if (NTP_UPDATE_THROTTLE_MILLLISECONDS < (15UL * 1000UL))
         #error "NTP_UPDATE_THROTTLE_MILLLISECONDS less than 15 seconds ... may exceed rate limits"
     #endif
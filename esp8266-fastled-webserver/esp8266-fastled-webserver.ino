@@ -25,10 +25,6 @@ ESP8266HTTPUpdateServer httpUpdateServer;
 
 int utcOffsetInSeconds = -6 * 60 * 60;
 
-// Define NTP Client to get time
-WiFiUDP ntpUDP;
-NTPClient timeClient(ntpUDP, "pool.ntp.org", utcOffsetInSeconds, NTP_UPDATE_THROTTLE_MILLLISECONDS);
-
 String nameString;
 
 CRGB leds[NUM_PIXELS];
@@ -79,12 +75,53 @@ uint8_t gHue = 0; // rotating "base color" used by many of the patterns
 
 CRGB solidColor = CRGB::Blue;
 
+#if RENDER_TASK_ON_SEPARATE_CORE
+ParameterSnapshot<RenderParameters> renderParameterSnapshot;
+#endif
+const RenderParameters* frameParameters = nullptr;
+
+RenderParameters captureRenderParameters()
+{
+  RenderParameters result;
+  result.power = power;
+  result.brightness = brightness;
+  result.currentPatternIndex = currentPatternIndex;
+  result.showClock = showClock;
+  result.solidColor = solidColor;
+  return result;
+}
+
+// Called by the network side after anything may have changed the settings.
+void publishRenderParameters()
+{
+#if RENDER_TASK_ON_SEPARATE_CORE
+  renderParameterSnapshot.publish(captureRenderParameters());
+#endif
+}
+
+// Called by the renderer once, at the start of each frame.
+const RenderParameters& acquireRenderParameters()
+{
+#if RENDER_TASK_ON_SEPARATE_CORE
+  frameParameters = &renderParameterSnapshot.acquire();
+#else
+  static RenderParameters current;
+  current = captureRenderParameters();
+  frameParameters = &current;
+#endif
+  return *frameParameters;
+}
+
+// The settings for the frame currently being rendered.
+const RenderParameters& renderParameters()
+{
+  return *frameParameters;
+}
+
 // scale the brightness of all pixels down
 void dimAll(byte value)
 {
-  for (auto led : leds) {
-    led.nscale8(value);
-  }
+  nscale8Packed(leds, NUM_PIXELS, value);
 }
 
 // List of patterns to cycle through.  Each is defined as a separate function below.
@@ -269,30 +306,11 @@ void setup() {
   WiFi.setSleepMode(WIFI_NONE_SLEEP);
 
   Serial.begin(115200);
-  Serial.setDebugOutput(true);
+  Serial.setDebugOutput(LOG_LEVEL >= LOG_LEVEL_DEBUG); // the SDK writes its messages synchronously
 
   uint16_t milliAmps = (AVAILABLE_MILLI_AMPS < MAX_MILLI_AMPS) ? AVAILABLE_MILLI_AMPS : MAX_MILLI_AMPS;
 
-  #if PARALLEL_OUTPUT_CHANNELS == 1
-  FastLED.addLeds<LED_TYPE, DATA_PIN, COLOR_ORDER>(leds, NUM_PIXELS);         // for WS2812 (Neopixel)
-  #else
-  #if PARALLEL_OUTPUT_CHANNELS >= 2
-  FastLED.addLeds<LED_TYPE, DATA_PIN,   COLOR_ORDER>(leds, LedOffset<1>(), LedCount<1>());
-  FastLED.addLeds<LED_TYPE, DATA_PIN_2, COLOR_ORDER>(leds, LedOffset<2>(), LedCount<2>());
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 3
-  FastLED.addLeds<LED_TYPE, DATA_PIN_3, COLOR_ORDER>(leds, LedOffset<3>(), LedCount<3>());
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 4
-  FastLED.addLeds<LED_TYPE, DATA_PIN_4, COLOR_ORDER>(leds, LedOffset<4>(), LedCount<4>());
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 5
-  FastLED.addLeds<LED_TYPE, DATA_PIN_5, COLOR_ORDER>(leds, LedOffset<5>(), LedCount<4>());
-  #endif
-  #if PARALLEL_OUTPUT_CHANNELS >= 6
-  FastLED.addLeds<LED_TYPE, DATA_PIN_6, COLOR_ORDER>(leds, LedOffset<6>(), LedCount<4>());
-  #endif
-  #endif // PARALLEL_OUTPUT_CHANNELS
+  addLedsForAllChannels(leds);                                                // for WS2812 (Neopixel)
 
   //FastLED.addLeds<LED_TYPE,DATA_PIN,CLK_PIN,COLOR_ORDER>(leds, NUM_PIXELS); // for APA102 (Dotstar)
 
@@ -355,6 +373,10 @@ void setup() {
       Serial.printf("FS File: %s, size: %s\n", fileName.c_str(), String(fileSize).c_str());
     }
     Serial.printf("\n");
+
+    loadLayoutFile();
+    loadIrRemotes();
+    buildAssetIndex();
   }
 
 
@@ -426,6 +448,13 @@ void setup() {
     webServer.send(200, "application/json", json);
   });
 
+  webServer.on("/log", HTTP_GET, []() {
+    String text;
+    const uint32_t position = logCopy(webServer.arg("since").toInt(), text);
+    webServer.sendHeader("X-Log-Position", String(position));
+    webServer.send(200, "text/plain", text);
+  });
+
   webServer.on("/fieldValue", HTTP_GET, []() {
     String name = webServer.arg("name");
     String value = getFieldValue(name);
@@ -599,7 +628,12 @@ void setup() {
       }, handleFileUpload);
 
   webServer.enableCORS(true);
-  webServer.serveStatic("/", LittleFS, "/", "max-age=86400");
+  // static files, from the asset index
+  webServer.onNotFound([]() {
+    if (!handleFileRead(webServer.uri())) webServer.send(404, "text/plain", "FileNotFound");
+  });
+  const char* headerKeys[] = { "If-None-Match" };
+  webServer.collectHeaders(headerKeys, ARRAY_SIZE2(headerKeys));
 
   MDNS.begin(nameChar);
   MDNS.setHostname(nameChar);
@@ -612,7 +646,15 @@ void setup() {
   //  Serial.println("Web socket server started");
 
   autoPlayTimeout = millis() + (autoplayDuration * 1000);
-  timeClient.begin();
+  ntpClock.begin();
+  ntpClock.setTimeOffset(utcOffsetInSeconds); // readSettings() only sets it from saved settings
+
+  publishRenderParameters();
+  startForkJoinWorker();
+#if RENDER_TASK_ON_SEPARATE_CORE
+  xTaskCreatePinnedToCore(networkTask, "network", 8192, nullptr, 1, nullptr, NETWORK_TASK_CORE);
+  xTaskCreatePinnedToCore(renderTask,  "render",  8192, nullptr, 1, nullptr, RENDER_TASK_CORE);
+#endif
 }
 
 void sendInt(uint8_t value)
@@ -627,31 +669,31 @@ void sendString(String value)
 
 void broadcastInt(String name, uint8_t value)
 {
+  governorWake(); // a setting changed
   String json = "{\"name\":\"" + name + "\",\"value\":" + String(value) + "}";
   //  webSocketsServer.broadcastTXT(json);
 }
 
 void broadcastString(String name, String value)
 {
+  governorWake(); // a setting changed
   String json = "{\"name\":\"" + name + "\",\"value\":\"" + String(value) + "\"}";
   //  webSocketsServer.broadcastTXT(json);
 }
 
-// TODO: Add board-specific entropy sources
-// e.g., using `uint32_t esp_random()`, if exposed in Arduino ESP32 / ESP8266 BSPs
-// e.g., directly reading from 0x3FF20E44 on ESP8266 (dangerous! no entropy validation, whitening)
-// e.g., directly reading from 0x3FF75144 on ESP32   (dangerous! no entropy validation, whitening)
-// e.g., directly reading from RANDOM_REG32          (dangerous! no entropy validation, whitening)
-// e.g., using a library, such as https://github.com/marvinroger/ESP8266TrueRandom/blob/master/ESP8266TrueRandom.cpp (less dangerous?)
-// e.g., directly reading REG_READ(WDEV_RND_REG)     (dangerous! no check for sufficient clock cycles passed for entropy)
-void loop() {
-  // Modify random number generator seed; we use a lot of it.  (Note: this is still deterministic)
-  random16_add_entropy(random(65535));
-
+// Everything that talks to the network, or that changes settings in response.
+// When RENDER_TASK_ON_SEPARATE_CORE, this runs on core 0 alongside the WiFi stack,
+// and must not touch leds[] or FastLED directly; changes reach the renderer
+// through publishRenderParameters().
+void handleNetwork() {
   //  webSocketsServer.loop();
 
   wifiManager.process();
   webServer.handleClient();
+  pumpTransfers(TRANSFER_LOOP_MICROS); // at least one chunk, also when frames overrun and the governor does not sleep
+  if (webServer.client() || transfersPending()) {
+    governorWake(); // a request is in progress, so more are likely to follow
+  }
   MDNS.update();
 
   static bool hasConnected = false;
@@ -672,17 +714,75 @@ void loop() {
       Serial.print(" or http://");
       Serial.print(nameString);
       Serial.println(".local in your browser");
-    } else {
-      timeClient.update(); // NTPClient has throttling built-in
     }
   }
+  ntpClock.update(); // never waits for the network; requests no more often than NTP_UPDATE_THROTTLE_MILLLISECONDS
 
   checkPingTimer();
   handleIrInput();  // empty function when ENABLE_IR is not defined
 
-  if (power == 0) {
+  if (power && autoplay && (millis() > autoPlayTimeout)) {
+    adjustPattern(true);
+    autoPlayTimeout = millis() + (autoplayDuration * 1000);
+  }
+
+  publishRenderParameters();
+}
+
+// Time at which the current frame is rendered, taken once at the start of each frame.
+// While a frame is rendered, FastLED's beat functions and EVERY_N_* timers read it
+// through GET_MILLIS() (see USE_GET_MILLISECOND_TIMER in common.h), as do the
+// patterns, so a whole frame is rendered at one consistent instant.  Everywhere
+// else, including handleNetwork(), they read millis().
+static uint32_t frameMillis = 0;
+static bool renderingFrame = false;
+#if RENDER_TASK_ON_SEPARATE_CORE
+static TaskHandle_t renderTaskHandle = nullptr; // the network task must not see frameMillis
+#endif
+
+uint32_t get_millisecond_timer() {
+#if RENDER_TASK_ON_SEPARATE_CORE
+  if (xTaskGetCurrentTaskHandle() != renderTaskHandle) {
+    return millis();
+  }
+#endif
+  return renderingFrame ? frameMillis : millis();
+}
+
+// TODO: Add board-specific entropy sources
+// e.g., using `uint32_t esp_random()`, if exposed in Arduino ESP32 / ESP8266 BSPs
+// e.g., directly reading from 0x3FF20E44 on ESP8266 (dangerous! no entropy validation, whitening)
+// e.g., directly reading from 0x3FF75144 on ESP32   (dangerous! no entropy validation, whitening)
+// e.g., directly reading from RANDOM_REG32          (dangerous! no entropy validation, whitening)
+// e.g., using a library, such as https://github.com/marvinroger/ESP8266TrueRandom/blob/master/ESP8266TrueRandom.cpp (less dangerous?)
+// e.g., directly reading REG_READ(WDEV_RND_REG)     (dangerous! no check for sufficient clock cycles passed for entropy)
+
+// Renders and outputs a single frame.
+// When RENDER_TASK_ON_SEPARATE_CORE, this runs on core 1, and reads settings
+// only through the snapshot taken at the start of the frame.
+void renderFrame() {
+  frameMillis = millis();
+  renderingFrame = true;
+  drawAndShowFrame();
+  renderingFrame = false;
+}
+
+void drawAndShowFrame() {
+  // Modify random number generator seed; we use a lot of it.  (Note: this is still deterministic)
+  random16_add_entropy(random(65535));
+
+  const RenderParameters& parameters = acquireRenderParameters();
+  FastLED.setBrightness(parameters.brightness);
+
+  if (!governorBeginFrame(parameters)) {
+    governorWait(); // idle, and no frame is due yet
+    return;
+  }
+
+  if (parameters.power == 0) {
     fill_solid(leds, NUM_PIXELS, CRGB::Black);
-    FastLED.delay(1000 / FRAMES_PER_SECOND); // this function calls FastLED.show() at least once
+    invalidateLogicalPixels();
+    governorShowAndWait();
     return;
   }
 
@@ -702,22 +802,62 @@ void loop() {
     gHue++;  // slowly cycle the "base color" through the rainbow
   }
 
-  if (autoplay && (millis() > autoPlayTimeout)) {
-    adjustPattern(true);
-    autoPlayTimeout = millis() + (autoplayDuration * 1000);
+  // Buffers that only some patterns use are built on their first frame, and freed here
+  static uint8_t previousPatternIndex = 0xFF;
+  if (parameters.currentPatternIndex != previousPatternIndex) {
+    previousPatternIndex = parameters.currentPatternIndex;
+    releaseTwinkleFoxPixels();
+    releaseTwinkleList();
+    releaseWaveTables();
+    #if HAS_COORDINATE_MAP
+    releaseMapBuffers();
+    #endif
   }
 
   // Call the current pattern function once, updating the 'leds' array
-  patterns[currentPatternIndex].pattern();
+  patterns[parameters.currentPatternIndex].pattern();
+  outputLogicalPixels(); // permute into physical order, when the pattern drew in logical order
 
   #if HAS_COORDINATE_MAP
-  if (showClock) drawAnalogClock();
+  if (parameters.showClock) {
+    drawAnalogClock();
+    invalidateLogicalPixels(); // so the next frame starts from leds[], including the clock
+  }
   #endif
 
-  // insert a delay to keep the framerate modest ... this is guaranteed to call FastLED.show() at least once
-  FastLED.delay(1000 / FRAMES_PER_SECOND);
+  governorFrameDrawn(); // notices when the pattern keeps drawing the same frame
+
+  governorShowAndWait(); // outputs the frame, then waits out the frame period
+}
+
+#if RENDER_TASK_ON_SEPARATE_CORE
+void networkTask(void*) {
+  for (;;) {
+    handleNetwork();
+    vTaskDelay(1); // let the idle task on this core feed the watchdog
+  }
+}
+
+void renderTask(void*) {
+  renderTaskHandle = xTaskGetCurrentTaskHandle();
+  for (;;) {
+    renderFrame(); // delay() yields at least once per frame
+    logDrain();
+  }
 }
 
+void loop() {
+  // all work is done by networkTask() and renderTask(), started in setup()
+  vTaskDelete(nullptr);
+}
+#else
+void loop() {
+  handleNetwork();
+  renderFrame();
+  logDrain(); // also when the frame overran, and the governor did not sleep
+}
+#endif
+
 //void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length) {
 //
 //  switch (type) {
@@ -941,7 +1081,6 @@ void adjustBrightness(bool up)
 
   brightness = brightnessMap[brightnessIndex];
 
-  FastLED.setBrightness(brightness);
   writeAndCommitSettings();
   broadcastInt("brightness", brightness);
 }
@@ -950,7 +1089,6 @@ void setBrightness(uint8_t value)
 {
   brightness = value;
 
-  FastLED.setBrightness(brightness);
   writeAndCommitSettings();
   broadcastInt("brightness", brightness);
 }
@@ -968,12 +1106,12 @@ void strandTest()
 
   fill_solid(leds, NUM_PIXELS, CRGB::Black);
 
-  leds[i] = solidColor;
+  leds[i] = renderParameters().solidColor;
 }
 
 void showSolidColor()
 {
-  fill_solid(leds, NUM_PIXELS, solidColor);
+  fill_solid(leds, NUM_PIXELS, renderParameters().solidColor);
 }
 
 // Patterns from FastLED example DemoReel100: https://github.com/FastLED/FastLED/blob/master/examples/DemoReel100/DemoReel100.ino
@@ -999,7 +1137,7 @@ void rainbowSolid()
 void confetti()
 {
   // random colored speckles that blink in and fade smoothly
-  fadeToBlackBy( leds, NUM_PIXELS, 10);
+  fadeToBlackByPacked( leds, NUM_PIXELS, 10);
   int pos = random16(NUM_PIXELS);
   // leds[pos] += CHSV( gHue + random8(64), 200, 255);
   leds[pos] += ColorFromPalette(palettes[currentPaletteIndex], gHue + random8(64));
@@ -1008,7 +1146,7 @@ void confetti()
 void sinelon()
 {
   // a colored dot sweeping back and forth, with fading trails
-  fadeToBlackBy( leds, NUM_PIXELS, 20);
+  fadeToBlackByPacked( leds, NUM_PIXELS, 20);
   int pos = beatsin16(speed, 0, NUM_PIXELS);
   static int prevpos = 0;
   CRGB color = ColorFromPalette(palettes[currentPaletteIndex], gHue, 255);
@@ -1042,7 +1180,7 @@ void juggle()
   static uint8_t   basebeat =   5; // Higher = faster movement.
 
  static uint8_t lastSecond =  99;  // Static variable, means it's only defined once. This is our 'debounce' variable.
-  uint8_t secondHand = (millis() / 1000) % 30; // IMPORTANT!!! Change '30' to a different value to change duration of the loop.
+  uint8_t secondHand = (GET_MILLIS() / 1000) % 30; // IMPORTANT!!! Change '30' to a different value to change duration of the loop.
 
   if (lastSecond != secondHand) { // Debounce to make sure we're not repeating an assignment.
     lastSecond = secondHand;
@@ -1056,7 +1194,7 @@ void juggle()
 
   // Several colored dots, weaving in and out of sync with each other
   curhue = thishue; // Reset the hue values.
-  fadeToBlackBy(leds, NUM_PIXELS, faderate);
+  fadeToBlackByPacked(leds, NUM_PIXELS, faderate);
   for ( int i = 0; i < numdots; i++) {
     //beat16 is a FastLED 3.1 function
     leds[beatsin16(basebeat + i + numdots, 0, NUM_PIXELS)] += CHSV(gHue + curhue, thissat, thisbright);
@@ -1074,15 +1212,19 @@ void water()
   heatMap(IceColors_p, false);
 }
 
+// Pride's animation state.  Outside the template, so that pride() and prideFibonacci()
+// continue the same animation, as when they were one function.
+static uint16_t sPridePseudotime = 0;
+static uint16_t sPrideLastMillis = 0;
+static uint16_t sPrideHue16 = 0;
+
 // Pride2015 by Mark Kriegsman: https://gist.github.com/kriegsman/964de772d64c502760e5
 // This function draws rainbows with an ever-changing,
 // widely-varying set of parameters.
-void fillWithPride(bool useFibonacciOrder)
+// ORDER is PIXEL_ORDER_REVERSED, optionally with PIXEL_ORDER_FIBONACCI
+template <PixelOrder ORDER>
+void fillWithPride()
 {
-  static uint16_t sPseudotime = 0;
-  static uint16_t sLastMillis = 0;
-  static uint16_t sHue16 = 0;
-
   // uint8_t sat8 = beatsin88( 87, 220, 250);
   uint8_t sat8 = beatsin88( 43.5, 220, 250);
   // uint8_t brightdepth = beatsin88( 341, 96, 224);
@@ -1092,143 +1234,89 @@ void fillWithPride(bool useFibonacciOrder)
   // uint8_t msmultiplier = beatsin88(147, 23, 60);
   uint8_t msmultiplier = beatsin88(74, 23, 60);
 
-  uint16_t hue16 = sHue16;//gHue * 256;
+  const uint16_t hue16Start = sPrideHue16;//gHue * 256;
   // uint16_t hueinc16 = beatsin88(113, 1, 3000);
   uint16_t hueinc16 = beatsin88(57, 1, 128);
 
-  uint16_t ms = millis();
-  uint16_t deltams = ms - sLastMillis ;
-  sLastMillis  = ms;
-  sPseudotime += deltams * msmultiplier;
+  uint16_t ms = GET_MILLIS();
+  uint16_t deltams = ms - sPrideLastMillis ;
+  sPrideLastMillis  = ms;
+  sPridePseudotime += deltams * msmultiplier;
   // sHue16 += deltams * beatsin88( 400, 5, 9);
-  sHue16 += deltams * beatsin88( 200, 5, 9);
-  uint16_t brightnesstheta16 = sPseudotime;
+  sPrideHue16 += deltams * beatsin88( 200, 5, 9);
+  const uint16_t brightnesstheta16Start = sPridePseudotime;
+  BrightnessWave brightness(brightdepth);
+  RainbowTable rainbow(sat8);
 
-  for ( uint16_t i = 0 ; i < NUM_PIXELS; i++) {
-    hue16 += hueinc16;
-    uint8_t hue8 = hue16 / 256;
+  LogicalPixels<ORDER> pixels;
 
-    brightnesstheta16  += brightnessthetainc16;
-    uint16_t b16 = sin16( brightnesstheta16  ) + 32768;
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    // hue and brightness phase advance by a fixed step per pixel,
+    // so each range can start part-way through the sequence
+    uint16_t hue16 = hue16Start + first * hueinc16;
+    uint16_t brightnesstheta16 = brightnesstheta16Start + first * brightnessthetainc16;
+    RowBlender<ORDER> blender(pixels, first, 64);
 
-    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
-    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
-    bri8 += (255 - brightdepth);
+    for (uint16_t i = first; i < last; i++) {
+      hue16 += hueinc16;
+      uint8_t hue8 = hue16 / 256;
 
-    CRGB newcolor = CHSV( hue8, sat8, bri8);
+      brightnesstheta16 += brightnessthetainc16;
+      uint8_t bri8 = brightness(brightnesstheta16);
 
-    uint16_t pixelnumber = i;
+      CRGB newcolor = rainbow(hue8, bri8);
 
-#if IS_FIBONACCI
-    if (useFibonacciOrder) pixelnumber = fibonacciToPhysical[i];
-#else
-    (void)useFibonacciOrder; // unused parameter
-#endif
-
-    pixelnumber = (NUM_PIXELS - 1) - pixelnumber;
-
-    nblend( leds[pixelnumber], newcolor, 64);
-  }
+      blender.push(newcolor);
+    }
+    blender.flush();
+  };
+  forEachPixelRange(NUM_PIXELS, kernel);
 }
 void pride() {
-  fillWithPride(false);
+  fillWithPride<PIXEL_ORDER_REVERSED>();
 }
 #if IS_FIBONACCI // prideFibonacci() uses fibonacciToPhysical
 void prideFibonacci() {
-  fillWithPride(true);
+  fillWithPride<PIXEL_ORDER_REVERSED_FIBONACCI>();
 }
 #endif
 
-void fillRadialPaletteShift(bool useFibonacciOrder)
+template <PixelOrder ORDER>
+void fillRadialPaletteShift()
 {
+  LogicalPixels<ORDER> pixels;
   for (uint16_t i = 0; i < NUM_PIXELS; i++) {
-    #if IS_FIBONACCI
-      uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
-    #else
-      (void)useFibonacciOrder;
-      uint16_t idx = i;
-    #endif
-    leds[idx] = ColorFromPalette(gCurrentPalette, i + gHue, 255, LINEARBLEND);
+    pixels[i] = ColorFromPalette(gCurrentPalette, i + gHue, 255, LINEARBLEND);
   }
 }
-void fillRadialPaletteShiftOutward(bool useFibonacciOrder)
+template <PixelOrder ORDER>
+void fillRadialPaletteShiftOutward()
 {
+  LogicalPixels<ORDER> pixels;
   for (uint16_t i = 0; i < NUM_PIXELS; i++) {
-    #if IS_FIBONACCI
-      uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
-    #else
-      (void)useFibonacciOrder;
-      uint16_t idx = i;
-    #endif
-    leds[idx] = ColorFromPalette(gCurrentPalette, i - gHue, 255, LINEARBLEND);
+    pixels[i] = ColorFromPalette(gCurrentPalette, i - gHue, 255, LINEARBLEND);
   }
 }
 // TODO: define function radialPaletteShiftFibonacci()
 void radialPaletteShift()
 {
   #if IS_FIBONACCI
-    fillRadialPaletteShift(true);
+    fillRadialPaletteShift<PIXEL_ORDER_FIBONACCI>();
   #else
-    fillRadialPaletteShift(false);
+    fillRadialPaletteShift<PIXEL_ORDER_LINEAR>();
   #endif
 }
 // TODO: define function radialPaletteShiftOutwardFibonacci(), and update to call corresponding function
 void radialPaletteShiftOutward()
 {
   #if IS_FIBONACCI
-    fillRadialPaletteShiftOutward(true);
+    fillRadialPaletteShiftOutward<PIXEL_ORDER_FIBONACCI>();
   #else
-    fillRadialPaletteShiftOutward(false);
+    fillRadialPaletteShiftOutward<PIXEL_ORDER_LINEAR>();
   #endif
 }
 
 
-// based on FastLED example Fire2012WithPalette: https://github.com/FastLED/FastLED/blob/master/examples/Fire2012WithPalette/Fire2012WithPalette.ino
-void heatMap(const CRGBPalette16& palette, bool up)
-{
-  fill_solid(leds, NUM_PIXELS, CRGB::Black);
-
-  // Modify random number generator seed; we use a lot of it.  (Note: this is still deterministic)
-  random16_add_entropy(random(256));
-
-  // Array of temperature readings at each simulation cell
-  static byte heat[NUM_PIXELS];
-
-  byte colorindex;
-
-  // Step 1.  Cool down every cell a little
-  for ( uint16_t i = 0; i < NUM_PIXELS; i++) {
-    heat[i] = qsub8( heat[i],  random8(0, ((cooling * 10) / NUM_PIXELS) + 2));
-  }
-
-  // Step 2.  Heat from each cell drifts 'up' and diffuses a little
-  for ( uint16_t k = NUM_PIXELS - 1; k >= 2; k--) {
-    heat[k] = (heat[k - 1] + heat[k - 2] + heat[k - 2] ) / 3;
-  }
-
-  // Step 3.  Randomly ignite new 'sparks' of heat near the bottom
-  if ( random8() < sparking ) {
-    int y = random8(7);
-    heat[y] = qadd8( heat[y], random8(160, 255) );
-  }
-
-  // Step 4.  Map from heat cells to LED colors
-  for ( uint16_t j = 0; j < NUM_PIXELS; j++) {
-    // Scale the heat value from 0-255 down to 0-240
-    // for best results with color palettes.
-    colorindex = scale8(heat[j], 190);
-
-    CRGB color = ColorFromPalette(palette, colorindex);
-
-    if (up) {
-      leds[j] = color;
-    }
-    else {
-      leds[(NUM_PIXELS - 1) - j] = color;
-    }
-  }
-}
-
 void addGlitter( uint8_t chanceOfGlitter)
 {
   if ( random8() < chanceOfGlitter) {
@@ -1250,15 +1338,18 @@ uint8_t beatsaw8( accum88 beats_per_minute, uint8_t lowest = 0, uint8_t highest
 }
 
 
+// Shared by colorWaves() and colorWavesFibonacci(), as for Pride above
+static uint16_t sColorwavesPseudotime = 0;
+static uint16_t sColorwavesLastMillis = 0;
+static uint16_t sColorwavesHue16 = 0;
+
 // ColorWavesWithPalettes by Mark Kriegsman: https://gist.github.com/kriegsman/8281905786e8b2632aeb
 // This function draws color waves with an ever-changing,
 // widely-varying set of parameters, using a color palette.
-void fillWithColorwaves( CRGB* ledarray, uint16_t numleds, const CRGBPalette16& palette, bool useFibonacciOrder)
+// ORDER is PIXEL_ORDER_REVERSED, optionally with PIXEL_ORDER_FIBONACCI
+template <PixelOrder ORDER>
+void fillWithColorwaves( const CRGBPalette16& palette)
 {
-  static uint16_t sPseudotime = 0;
-  static uint16_t sLastMillis = 0;
-  static uint16_t sHue16 = 0;
-
   // uint8_t sat8 = beatsin88( 87, 220, 250);
   // uint8_t brightdepth = beatsin88( 341, 96, 224);
   uint8_t brightdepth = beatsin88(171, 96, 224);
@@ -1267,61 +1358,62 @@ void fillWithColorwaves( CRGB* ledarray, uint16_t numleds, const CRGBPalette16&
   // uint8_t msmultiplier = beatsin88(147, 23, 60);
   uint8_t msmultiplier = beatsin88(74, 23, 60);
 
-  uint16_t hue16 = sHue16;//gHue * 256;
+  const uint16_t hue16Start = sColorwavesHue16;//gHue * 256;
   // uint16_t hueinc16 = beatsin88(113, 300, 1500);
   uint16_t hueinc16 = beatsin88(57, 1, 128);
 
-  uint16_t ms = millis();
-  uint16_t deltams = ms - sLastMillis ;
-  sLastMillis  = ms;
-  sPseudotime += deltams * msmultiplier;
+  uint16_t ms = GET_MILLIS();
+  uint16_t deltams = ms - sColorwavesLastMillis ;
+  sColorwavesLastMillis  = ms;
+  sColorwavesPseudotime += deltams * msmultiplier;
   // sHue16 += deltams * beatsin88( 400, 5, 9);
-  sHue16 += deltams * beatsin88( 200, 5, 9);
-  uint16_t brightnesstheta16 = sPseudotime;
-
-  for ( uint16_t i = 0 ; i < numleds; i++) {
-    hue16 += hueinc16;
-    uint8_t hue8 = hue16 / 256;
-    uint16_t h16_128 = hue16 >> 7;
-    if ( h16_128 & 0x100) {
-      hue8 = 255 - (h16_128 >> 1);
-    } else {
-      hue8 = h16_128 >> 1;
-    }
-
-    brightnesstheta16  += brightnessthetainc16;
-    uint16_t b16 = sin16( brightnesstheta16  ) + 32768;
-
-    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
-    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * brightdepth) / 65536;
-    bri8 += (255 - brightdepth);
+  sColorwavesHue16 += deltams * beatsin88( 200, 5, 9);
+  const uint16_t brightnesstheta16Start = sColorwavesPseudotime;
+  BrightnessWave brightness(brightdepth);
+
+  LogicalPixels<ORDER> pixels;
+
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    // hue and brightness phase advance by a fixed step per pixel,
+    // so each range can start part-way through the sequence
+    uint16_t hue16 = hue16Start + first * hueinc16;
+    uint16_t brightnesstheta16 = brightnesstheta16Start + first * brightnessthetainc16;
+    RowBlender<ORDER> blender(pixels, first, 128);
+
+    for (uint16_t i = first; i < last; i++) {
+      hue16 += hueinc16;
+      uint8_t hue8 = hue16 / 256;
+      uint16_t h16_128 = hue16 >> 7;
+      if ( h16_128 & 0x100) {
+        hue8 = 255 - (h16_128 >> 1);
+      } else {
+        hue8 = h16_128 >> 1;
+      }
 
-    uint8_t index = hue8;
-    //index = triwave8( index);
-    index = scale8( index, 240);
+      brightnesstheta16 += brightnessthetainc16;
+      uint8_t bri8 = brightness(brightnesstheta16);
 
-    CRGB newcolor = ColorFromPalette( palette, index, bri8);
+      uint8_t index = hue8;
+      //index = triwave8( index);
+      index = scale8( index, 240);
 
-    uint16_t pixelnumber = i;
-#if IS_FIBONACCI
-    if (useFibonacciOrder) pixelnumber = fibonacciToPhysical[i];
-#else
-    (void)useFibonacciOrder;
-#endif
-    pixelnumber = (numleds - 1) - pixelnumber;
+      CRGB newcolor = ColorFromPalette( palette, index, bri8);
 
-    nblend( ledarray[pixelnumber], newcolor, 128);
-  }
+      blender.push(newcolor);
+    }
+    blender.flush();
+  };
+  forEachPixelRange(NUM_PIXELS, kernel);
 }
 
 void colorWaves()
 {
-  fillWithColorwaves( leds, NUM_PIXELS, gCurrentPalette, false);
+  fillWithColorwaves<PIXEL_ORDER_REVERSED>( gCurrentPalette);
 }
 #if IS_FIBONACCI // colorWavesFibonacci() uses fibonacciToPhysical
 void colorWavesFibonacci()
 {
-  fillWithColorwaves( leds, NUM_PIXELS, gCurrentPalette, true);
+  fillWithColorwaves<PIXEL_ORDER_REVERSED_FIBONACCI>( gCurrentPalette);
 }
 #endif
 
@@ -1352,9 +1444,11 @@ void swirlFibonacci() {
 
   CRGBPalette16 palette( gGradientPalettes[1] ); // es_rivendell_15_gp
 
+  MapTableStream<fibonacci_index_t> spiralIndices(physicalToFibonacci);
+  MapTableStream<uint8_t> pixelAngles(angles);
   for (uint16_t i = 0; i < NUM_PIXELS; i++) {
-    float r = physicalToFibonacci[i] / 256.0 * z;
-    float a = (angles[i] + (beat88(3*speed)>>3)) / 256.0 * TWO_PI;
+    float r = spiralIndices.next() / 256.0 * z;
+    float a = (pixelAngles.next() + (beat88(3*speed)>>3)) / 256.0 * TWO_PI;
     float v = r - p + d * sin(w * a + s * r * r);
     float c = 255 - b * pow(fabs(v), g);
     if (c < 0) c = 0;
@@ -1368,9 +1462,11 @@ void swirlFibonacci() {
 #if IS_FIBONACCI // fireFibonacci() uses coordsX/coordsY
 // TODO: combine with normal fire effect
 void fireFibonacci() {
+  MapTableStream<uint8_t> xs(coordsX);
+  MapTableStream<uint8_t> ys(coordsY);
   for (uint16_t i = 0; i < NUM_PIXELS; i++) {
-    uint16_t x = coordsX[i];
-    uint16_t y = coordsY[i];
+    uint16_t x = xs.next();
+    uint16_t y = ys.next();
 
     uint8_t n = qsub8(inoise8((y << 2) - beat88(speed << 2), (x << 2)), y);
 
@@ -1382,9 +1478,11 @@ void fireFibonacci() {
 #if IS_FIBONACCI // waterFibonacci() uses coordsX/coordsY
 // TODO: combine with normal water effect
 void waterFibonacci() {
+  MapTableStream<uint8_t> xs(coordsX);
+  MapTableStream<uint8_t> ys(coordsY);
   for (uint16_t i = 0; i < NUM_PIXELS; i++) {
-    uint16_t x = coordsX[i];
-    uint16_t y = coordsY[i];
+    uint16_t x = xs.next();
+    uint16_t y = ys.next();
 
     uint8_t n = inoise8((y << 2) + beat88(speed << 2), (x << 4));
 
@@ -1421,7 +1519,7 @@ void emitterFibonacci() {
   }
 
   // fade traces
-  fadeToBlackBy( ledBuffer, NUM_PIXELS, 6 + (speed >> 3));
+  fadeToBlackByPacked( ledBuffer, NUM_PIXELS, 6 + (speed >> 3));
 
   // draw traces
   for (uint8_t e = 0; e < eCount; e++) {
@@ -1455,47 +1553,9 @@ void multi_test() {
     Serial.println(step);
   }
 
-  static_assert(PARALLEL_OUTPUT_CHANNELS <= 6, "");
   for (uint8_t strip = 0; strip < PARALLEL_OUTPUT_CHANNELS; strip++) {
-    uint16_t pixelOffset;
-    uint16_t pixelCount;
-    if (strip == 0) {
-      pixelOffset = LedOffset<1>(); // uses one-based indices... sigh.
-      pixelCount  = LedCount<1>();  // uses one-based indices... sigh.
-    }
-#if (PARALLEL_OUTPUT_CHANNELS >= 2)
-    else if (strip == 1) {
-      pixelOffset = LedOffset<2>(); // uses one-based indices... sigh.
-      pixelCount  = LedCount<2>();  // uses one-based indices... sigh.
-    }
-#endif    
-#if (PARALLEL_OUTPUT_CHANNELS >= 3)
-    else if (strip == 2) {
-      pixelOffset = LedOffset<3>(); // uses one-based indices... sigh.
-      pixelCount  = LedCount<3>();  // uses one-based indices... sigh.
-    }
-#endif
-#if (PARALLEL_OUTPUT_CHANNELS >= 4)
-    else if (strip == 3) {
-      pixelOffset = LedOffset<4>(); // uses one-based indices... sigh.
-      pixelCount  = LedCount<4>();  // uses one-based indices... sigh.
-    }
-#endif
-#if (PARALLEL_OUTPUT_CHANNELS > 5)
-    else if (strip == 4) {
-      pixelOffset = LedOffset<5>(); // uses one-based indices... sigh.
-      pixelCount  = LedCount<5>();  // uses one-based indices... sigh.
-    }
-#endif
-#if (PARALLEL_OUTPUT_CHANNELS > 6)
-    else if (strip == 5) {
-      pixelOffset = LedOffset<6>(); // uses one-based indices... sigh.
-      pixelCount  = LedCount<6>();  // uses one-based indices... sigh. 
-    }
-#endif
-    else {
-      break;
-    }
+    uint16_t pixelOffset = channelPixelOffset(strip);
+    uint16_t pixelCount  = channelPixelCount(strip);
 
     uint8_t hue = gHue + strip * step;
     CHSV c = CHSV(hue, 255, 255);
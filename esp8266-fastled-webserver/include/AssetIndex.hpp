@@ -0,0 +1,38 @@
+#pragma once
+#if !defined(ASSET_INDEX_HPP)
+#define ASSET_INDEX_HPP
+
+// An in-memory index of the files served from the file system, so a request
+// for a static file is a single binary search instead of several LittleFS
+// directory walks.  Each entry has the request path, whether the file is stored
+// gzipped (path + ".gz", which is preferred over the plain file), its size,
+// content type, and an ETag from a hash of its content and its size.
+//
+// A request whose If-None-Match matches the ETag is answered 304 Not Modified,
+// without touching the file system.
+//
+// The hashes are kept in /.assethashes, with each file's size and write time,
+// so buildAssetIndex() at boot (after the file system is mounted) reads the
+// directories and that file, and only hashes files it does not know yet, such
+// as every file of a newly uploaded file system image.  The write time alone
+// cannot be the ETag: without NTP setting the system time, LittleFS records
+// seconds since boot.  The file editor calls refreshAsset() when it creates,
+// uploads or deletes a file, which hashes that file.
+
+struct Asset {
+  String path;             // request path, without ".gz"
+  const char* contentType;
+  uint32_t size;           // bytes sent, i.e. of the .gz file when gzipped
+  uint32_t lastWrite;      // as recorded by the file system, to tell whether the kept hash is still the file's
+  uint32_t hash;           // FNV-1a of the content sent
+  bool gzipped;
+};
+
+void buildAssetIndex();
+void refreshAsset(String fsPath); // after the file at fsPath changed or was deleted
+const Asset* findAsset(const String& path);
+String formatETag(uint32_t hash, uint32_t size);
+String assetETag(const Asset& asset);
+uint16_t assetCount();
+
+#endif
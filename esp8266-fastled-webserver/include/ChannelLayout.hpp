@@ -0,0 +1,205 @@
+#pragma once
+#if !defined(CHANNEL_LAYOUT_HPP)
+#define CHANNEL_LAYOUT_HPP
+
+// Compile-time description of how leds[] is split across the parallel output channels.
+//
+// Channel N (zero-based) drives PIXELS_ON_DATA_PIN_(N+1) pixels from DATA_PIN_(N+1),
+// starting immediately after the pixels of channel N-1.  Everything else (offsets,
+// the FastLED.addLeds<>() calls, the multi-channel test pattern) is derived from
+// these two tables, so adding a channel only requires the product / controller
+// to define the corresponding PIXELS_ON_DATA_PIN_n and DATA_PIN_n symbols.
+
+static_assert(PARALLEL_OUTPUT_CHANNELS >= 1 && PARALLEL_OUTPUT_CHANNELS <= 16, "PARALLEL_OUTPUT_CHANNELS must be between 1 and 16");
+
+constexpr uint16_t channelPixelCounts[] = {
+  #if PARALLEL_OUTPUT_CHANNELS == 1
+    NUM_PIXELS,
+  #else
+    PIXELS_ON_DATA_PIN_1,
+    #if PARALLEL_OUTPUT_CHANNELS >= 2
+      PIXELS_ON_DATA_PIN_2,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 3
+      PIXELS_ON_DATA_PIN_3,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 4
+      PIXELS_ON_DATA_PIN_4,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 5
+      PIXELS_ON_DATA_PIN_5,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 6
+      PIXELS_ON_DATA_PIN_6,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 7
+      PIXELS_ON_DATA_PIN_7,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 8
+      PIXELS_ON_DATA_PIN_8,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 9
+      PIXELS_ON_DATA_PIN_9,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 10
+      PIXELS_ON_DATA_PIN_10,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 11
+      PIXELS_ON_DATA_PIN_11,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 12
+      PIXELS_ON_DATA_PIN_12,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 13
+      PIXELS_ON_DATA_PIN_13,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 14
+      PIXELS_ON_DATA_PIN_14,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 15
+      PIXELS_ON_DATA_PIN_15,
+    #endif
+    #if PARALLEL_OUTPUT_CHANNELS >= 16
+      PIXELS_ON_DATA_PIN_16,
+    #endif
+  #endif
+};
+
+constexpr uint8_t channelDataPins[] = {
+  DATA_PIN,
+  #if PARALLEL_OUTPUT_CHANNELS >= 2
+  DATA_PIN_2,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 3
+  DATA_PIN_3,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 4
+  DATA_PIN_4,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 5
+  DATA_PIN_5,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 6
+  DATA_PIN_6,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 7
+  DATA_PIN_7,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 8
+  DATA_PIN_8,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 9
+  DATA_PIN_9,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 10
+  DATA_PIN_10,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 11
+  DATA_PIN_11,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 12
+  DATA_PIN_12,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 13
+  DATA_PIN_13,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 14
+  DATA_PIN_14,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 15
+  DATA_PIN_15,
+  #endif
+  #if PARALLEL_OUTPUT_CHANNELS >= 16
+  DATA_PIN_16,
+  #endif
+};
+
+static_assert(ARRAY_SIZE2(channelPixelCounts) == PARALLEL_OUTPUT_CHANNELS, "");
+static_assert(ARRAY_SIZE2(channelDataPins)    == PARALLEL_OUTPUT_CHANNELS, "");
+
+// Number of pixels on channels [0, channel) ... i.e., the offset into leds[] of that channel.
+constexpr uint16_t channelPixelOffset(uint8_t channel) {
+  return (channel == 0) ? 0 : channelPixelOffset(channel - 1) + channelPixelCounts[channel - 1];
+}
+constexpr uint16_t channelPixelCount(uint8_t channel) {
+  return channelPixelCounts[channel];
+}
+
+static_assert(channelPixelOffset(PARALLEL_OUTPUT_CHANNELS) == NUM_PIXELS, "Sum of PIXELS_ON_DATA_PIN_n must equal NUM_PIXELS");
+
+#if PARALLEL_OUTPUT_BLOCK
+  // ESP8266 block-clockless output: one FastLED controller sends every channel at
+  // once, channel N on GPIO 12 + N, so all channels must be the same length.
+  constexpr bool channelsAreBlockLanes(uint8_t channel = 0) {
+    return (channel >= PARALLEL_OUTPUT_CHANNELS) ||
+           ((channelPixelCount(channel) == NUM_PIXELS / PARALLEL_OUTPUT_CHANNELS) &&
+            (channelDataPins[channel] == 12 + channel) &&
+            channelsAreBlockLanes(channel + 1));
+  }
+  static_assert(channelsAreBlockLanes(), "PARALLEL_OUTPUT_BLOCK: PIXELS_ON_DATA_PIN_n must all be equal, on DATA_PIN_n == GPIO 11 + n");
+
+  inline void addLedsForAllChannels(CRGB* leds) {
+    FastLED.addLeds<WS2811_PORTA, PARALLEL_OUTPUT_CHANNELS, COLOR_ORDER>(leds, NUM_PIXELS / PARALLEL_OUTPUT_CHANNELS);
+  }
+#else
+  // Calls FastLED.addLeds<>() once per channel.  The data pin must be a
+  // template argument, so this recurses at compile time over the channels.
+  template <uint8_t CHANNEL_COUNT>
+  struct ChannelRegistrar {
+    static void addLeds(CRGB* leds) {
+      ChannelRegistrar<CHANNEL_COUNT - 1>::addLeds(leds);
+      FastLED.addLeds<LED_TYPE, channelDataPins[CHANNEL_COUNT - 1], COLOR_ORDER>(
+        leds,
+        channelPixelOffset(CHANNEL_COUNT - 1),
+        channelPixelCount(CHANNEL_COUNT - 1)
+      );
+    }
+  };
+  template <>
+  struct ChannelRegistrar<0> {
+    static void addLeds(CRGB*) {}
+  };
+
+  inline void addLedsForAllChannels(CRGB* leds) {
+    ChannelRegistrar<PARALLEL_OUTPUT_CHANNELS>::addLeds(leds);
+  }
+#endif
+
+// The outputs showAllChannels() sends, and times, one after another.  On ESP8266,
+// each channel's own controller, bit-banged in turn, or the block controller with
+// every channel.  On ESP32, RMT / I2S send all channels concurrently, and a single
+// controller's showLeds() does not complete on its own, so only the whole is timed.
+#if PARALLEL_OUTPUT_BLOCK || defined(ARDUINO_ARCH_ESP32)
+  constexpr uint8_t outputCount = 1;
+#else
+  constexpr uint8_t outputCount = PARALLEL_OUTPUT_CHANNELS;
+#endif
+
+// Sends leds[] to the pixels, as FastLED.show() does, timing each output into
+// outputMicros[].  Returns the time taken by all of them.
+inline uint32_t showAllChannels(const CRGB* leds, uint32_t (&outputMicros)[outputCount]) {
+  #if defined(ARDUINO_ARCH_ESP32)
+    (void)leds;
+    const uint32_t start = micros();
+    FastLED.show();
+    outputMicros[0] = micros() - start;
+    return outputMicros[0];
+  #else
+    // FastLED's power limit sums each controller's pixels, which for the block
+    // controller are only the first channel's ... so it is applied here, to all of leds[].
+    const uint8_t scale = calculate_max_brightness_for_power_vmA(
+      leds, NUM_PIXELS, FastLED.getBrightness(), 5,
+      (AVAILABLE_MILLI_AMPS < MAX_MILLI_AMPS) ? AVAILABLE_MILLI_AMPS : MAX_MILLI_AMPS
+    );
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < outputCount; i++) {
+      const uint32_t start = micros();
+      FastLED[i].showLeds(scale);
+      outputMicros[i] = micros() - start;
+      total += outputMicros[i];
+    }
+    return total;
+  #endif
+}
+
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+#if !defined(ENERGY_GOVERNOR_HPP)
+#define ENERGY_GOVERNOR_HPP
+
+// Decides how often renderFrame() draws and outputs a frame, and how the
+// controller waits in between.
+//
+// * active: a frame every 1000 / FRAMES_PER_SECOND ms, output once, then sleeping
+//   (delay()) for the rest of the frame period.  On ESP32, the CPU clock follows
+//   the measured render load; once it is at its fastest, or on ESP8266, a pattern
+//   that takes longer than the frame period to render and show stretches the
+//   period (up to 100 ms), so frames stay evenly spaced with time left to sleep.
+// * static: the pattern has drawn identical frames for a second; frames are
+//   drawn at a low rate, until one differs.
+// * off: power is off; the pixels are blanked once, then only refreshed occasionally.
+//
+// While static or off, and a few seconds after the last input, WiFi uses modem
+// sleep, and the CPU runs at its lowest clock.  Any change of the render
+// parameters, an HTTP request or an IR command (governorWake()) returns to
+// active immediately.
+//
+// renderFrame() calls, in order:
+//
+//     if (!governorBeginFrame(parameters)) { governorWait(); return; } // nothing due yet
+//     ... draw into leds[] ...
+//     governorFrameDrawn();
+//     governorShowAndWait();
+//
+enum GovernorState : uint8_t {
+  GOVERNOR_ACTIVE,
+  GOVERNOR_STATIC,
+  GOVERNOR_OFF,
+};
+
+typedef struct {
+  GovernorState state;
+  bool     modemSleep;
+  uint32_t idleMillis;    // time spent static or off since boot
+  uint32_t sleepMillis;   // time spent in delay() between frames since boot
+  uint32_t framesSkipped; // frame periods in which nothing was drawn or output
+  uint32_t maxFrameGapMillis; // longest time between two consecutive active frames since boot
+  uint32_t framePeriodMillis; // the active frame period, stretched while the render load exceeds 1000 / FRAMES_PER_SECOND
+  uint32_t showMicros;    // the last frame's output, all channels
+  uint32_t outputShowMicros[outputCount]; // ... and of each output (see showAllChannels())
+} GovernorStats;
+
+#if ENERGY_GOVERNOR
+  void governorWake(); // may be called from the network task
+  bool governorBeginFrame(const RenderParameters& parameters);
+  void governorFrameDrawn();
+  void governorShowAndWait();
+  void governorWait();
+  GovernorStats governorStats();
+#else
+  inline void governorWake() {}
+  inline bool governorBeginFrame(const RenderParameters&) { return true; }
+  inline void governorFrameDrawn() {}
+  inline void governorShowAndWait() {
+    logDrain();
+    uint32_t outputMicros[outputCount];
+    showAllChannels(leds, outputMicros);
+    // insert a delay to keep the framerate modest
+    delay(1000 / FRAMES_PER_SECOND);
+  }
+  inline void governorWait() {}
+  inline GovernorStats governorStats() { return GovernorStats { GOVERNOR_ACTIVE, false, 0, 0, 0, 0, 1000 / FRAMES_PER_SECOND, 0, {} }; }
+#endif
+
+const __FlashStringHelper* governorStateName(GovernorState state);
+
+#endif
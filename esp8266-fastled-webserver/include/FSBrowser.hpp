@@ -8,7 +8,9 @@ extern File fsUploadFile;
 
 //format bytes
 String formatBytes(size_t bytes);
+const char* contentTypeForPath(const String& filename);
 String getContentType(String filename);
+bool sendNotModified(const String& etag);
 bool handleFileRead(String path);
 void handleFileUpload();
 void handleFileDelete();
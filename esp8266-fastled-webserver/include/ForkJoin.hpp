@@ -0,0 +1,44 @@
+#pragma once
+#if !defined(FORK_JOIN_HPP)
+#define FORK_JOIN_HPP
+
+// Runs a per-pixel kernel over [0, count), split into two ranges.
+//
+// When PARALLEL_PIXEL_KERNELS is enabled (ESP32), the upper range is rendered
+// by a worker task on the other core while the calling task renders the lower
+// range, and the call returns only once both halves are done (i.e., before show()).
+// Otherwise, the kernel is simply called once for the whole range.
+//
+// Kernels must only write pixels inside the range they are given, and must not
+// depend on results computed for other pixels in the same pass.
+//
+// Example:
+//
+//     auto kernel = [&](uint16_t first, uint16_t last) {
+//       for (uint16_t i = first; i < last; i++) { leds[i] = ...; }
+//     };
+//     forEachPixelRange(NUM_PIXELS, kernel);
+//
+typedef void (*PixelRangeFunction)(void* context, uint16_t first, uint16_t last);
+
+#if PARALLEL_PIXEL_KERNELS
+  void startForkJoinWorker();
+  void forkJoinPixelRanges(PixelRangeFunction function, void* context, uint16_t count);
+#else
+  inline void startForkJoinWorker() {}
+  inline void forkJoinPixelRanges(PixelRangeFunction function, void* context, uint16_t count) {
+    function(context, 0, count);
+  }
+#endif
+
+template <typename Kernel>
+void invokePixelRangeKernel(void* context, uint16_t first, uint16_t last) {
+  (*static_cast<Kernel*>(context))(first, last);
+}
+
+template <typename Kernel>
+inline void forEachPixelRange(uint16_t count, Kernel& kernel) {
+  forkJoinPixelRanges(&invokePixelRangeKernel<Kernel>, &kernel, count);
+}
+
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+#if !defined(LAYOUT_FILE_HPP)
+#define LAYOUT_FILE_HPP
+
+// A layout file describes the physical arrangement of the pixels, replacing the
+// tables compiled into Map.cpp, so one firmware build can drive installations
+// that have the same number of pixels but a different shape or wiring.
+// Build one from a CSV file with scripts/layout-tool.py, and upload it as /layout.bin.
+//
+// All values are little-endian.  The file is a LayoutFileHeader, followed by
+// these sections, each padded with zeros to a multiple of four bytes:
+//
+//     uint8_t  coordsX[pixelCount]
+//     uint8_t  coordsY[pixelCount]
+//     uint8_t  angles[pixelCount]                  256 units == 360 degrees
+//     uint8_t  radius[pixelCount]                  used as radiusProxy[]
+//     index_t  physicalToFibonacci[pixelCount]     LAYOUT_HAS_FIBONACCI
+//     index_t  fibonacciToPhysical[pixelCount]     LAYOUT_HAS_FIBONACCI
+//     uint16_t neighbors[pixelCount][neighborsPerPixel]   LAYOUT_HAS_NEIGHBORS, 0xFFFF == none
+//     uint16_t rings[ringCount][2]                 LAYOUT_HAS_RINGS, { first, last } pixel, INCLUSIVE
+//
+// where index_t is uint16_t when pixelCount is greater than 256, otherwise uint8_t.
+//
+// The firmware keeps the sections it uses in one RAM block, laid out as in the
+// file, and reads them through the same MapTable accessors as the built-in maps.
+// The neighbor and ring sections are for tools and future patterns; they are
+// validated by layout-tool.py, and skipped here.
+
+#define LAYOUT_FILE_PATH    "/layout.bin"
+#define LAYOUT_FILE_MAGIC   "LAYT"
+#define LAYOUT_FILE_VERSION 1
+
+enum LayoutFileFlags : uint8_t {
+  LAYOUT_HAS_FIBONACCI = 1 << 0,
+  LAYOUT_HAS_NEIGHBORS = 1 << 1,
+  LAYOUT_HAS_RINGS     = 1 << 2,
+};
+
+struct LayoutFileHeader {
+  char     magic[4];          // LAYOUT_FILE_MAGIC
+  uint8_t  version;           // LAYOUT_FILE_VERSION
+  uint8_t  flags;             // LayoutFileFlags
+  uint8_t  neighborsPerPixel; // zero unless LAYOUT_HAS_NEIGHBORS
+  uint8_t  reserved;          // zero
+  uint16_t pixelCount;        // must equal NUM_PIXELS
+  uint16_t ringCount;         // zero unless LAYOUT_HAS_RINGS
+};
+static_assert(sizeof(LayoutFileHeader) == 12, "LayoutFileHeader must match the file format");
+
+#if RUNTIME_LAYOUT_FILE
+  // Call once at boot, after the file system is mounted and before the first frame.
+  // Returns false (keeping the built-in maps) when there is no valid layout file.
+  bool loadLayoutFile(const char* path = LAYOUT_FILE_PATH);
+  bool layoutFileLoaded();
+#else
+  inline bool loadLayoutFile(const char* = LAYOUT_FILE_PATH) { return false; }
+  inline bool layoutFileLoaded() { return false; }
+#endif
+
+#endif
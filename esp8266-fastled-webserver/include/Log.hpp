@@ -0,0 +1,59 @@
+#pragma once
+#if !defined(LOG_HPP)
+#define LOG_HPP
+
+// Leveled logging into a RAM ring buffer of LOG_BUFFER_SIZE bytes.
+//
+// LOG_ERROR() .. LOG_DEBUG() only format the message into the buffer, so they are
+// cheap enough for request handlers.  Messages above LOG_LEVEL compile to nothing,
+// arguments included.  The format string is kept in flash.
+//
+// The buffer is copied to Serial by logDrain(), only as much as the UART can take
+// without waiting, and at most LOG_DRAIN_MAX_BYTES per call.  It is called after
+// every frame, so the log keeps draining when frames overrun, and again while the
+// controller sleeps between frames; always from the render task.  GET /log returns
+// the buffer; GET /log?since=N returns only what was logged after position N,
+// where the X-Log-Position response header gives the position to use next time.
+// When the buffer overflows, the oldest lines are lost, from both.
+
+#define LOG_MESSAGE_MAX 160     // longer messages are truncated
+#define LOG_DRAIN_MAX_BYTES 128 // one UART FIFO's worth per logDrain() call
+
+// Never called: a message compiled out still names its arguments, so a variable
+// kept only for the message is not reported as unused
+template <typename... Arguments> inline void logNothing(const char*, const Arguments&...) {}
+
+#if (LOG_LEVEL >= LOG_LEVEL_ERROR)
+  #define LOG_ERROR(format, ...) logPrintf(LOG_LEVEL_ERROR, PSTR(format), ##__VA_ARGS__)
+#else
+  #define LOG_ERROR(format, ...) do { if (false) logNothing(format, ##__VA_ARGS__); } while (0)
+#endif
+#if (LOG_LEVEL >= LOG_LEVEL_WARN)
+  #define LOG_WARN(format, ...)  logPrintf(LOG_LEVEL_WARN,  PSTR(format), ##__VA_ARGS__)
+#else
+  #define LOG_WARN(format, ...)  do { if (false) logNothing(format, ##__VA_ARGS__); } while (0)
+#endif
+#if (LOG_LEVEL >= LOG_LEVEL_INFO)
+  #define LOG_INFO(format, ...)  logPrintf(LOG_LEVEL_INFO,  PSTR(format), ##__VA_ARGS__)
+#else
+  #define LOG_INFO(format, ...)  do { if (false) logNothing(format, ##__VA_ARGS__); } while (0)
+#endif
+#if (LOG_LEVEL >= LOG_LEVEL_DEBUG)
+  #define LOG_DEBUG(format, ...) logPrintf(LOG_LEVEL_DEBUG, PSTR(format), ##__VA_ARGS__)
+#else
+  #define LOG_DEBUG(format, ...) do { if (false) logNothing(format, ##__VA_ARGS__); } while (0)
+#endif
+
+#if (LOG_LEVEL > LOG_LEVEL_NONE)
+  // may be called from any task, but not from an interrupt
+  void logPrintf(uint8_t level, PGM_P format, ...) __attribute__((format(printf, 2, 3)));
+  void logDrain();
+  // Appends the text logged at or after position since (or the oldest text
+  // still in the buffer) to out.  Returns the position after the last byte.
+  uint32_t logCopy(uint32_t since, String& out);
+#else
+  inline void logDrain() {}
+  inline uint32_t logCopy(uint32_t, String&) { return 0; }
+#endif
+
+#endif
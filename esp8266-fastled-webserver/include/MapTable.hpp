@@ -0,0 +1,81 @@
+#pragma once
+#if !defined(MAP_TABLE_HPP)
+#define MAP_TABLE_HPP
+
+// The per-pixel maps (coordsX[], angles[], fibonacciToPhysical[], ...) are kept
+// in flash.  A plain `const` array is copied into RAM at boot on ESP8266, which
+// costs up to 8k of heap for the larger products.
+//
+// MapTable wraps such an array, so that it can still be indexed as before (each
+// access is one pgm_read_byte() or pgm_read_word()).  Loops that walk a table in
+// order should use MapTableStream instead, which reads one aligned 32-bit word
+// (four uint8_t entries, or two uint16_t entries) per pgm_read_dword().
+//
+// Arrays wrapped by MapTable must hold NUM_PIXELS entries, and are declared as:
+//
+//     const uint8_t coordsX_p[NUM_PIXELS] MAP_TABLE_PROGMEM { ... };
+//
+// A MapTable may also wrap a 4-byte aligned array in RAM, such as the tables of
+// a layout file loaded at boot (see LayoutFile.hpp).
+//
+#define MAP_TABLE_PROGMEM PROGMEM __attribute__((aligned(4)))
+
+template <typename T>
+class MapTable {
+  static_assert(sizeof(T) == 1 || sizeof(T) == 2, "MapTable entries are uint8_t or uint16_t");
+
+public:
+  static const uint8_t ENTRIES_PER_WORD = 4 / sizeof(T);
+
+  constexpr MapTable(const T* data) : _data(data) {}
+
+  // Only before the first frame is rendered, as tables derived from this one are built on first use
+  void setData(const T* data) { _data = data; }
+
+  T operator[](uint16_t i) const {
+    return (sizeof(T) == 1) ? pgm_read_byte(_data + i) : pgm_read_word(_data + i);
+  }
+
+  // the aligned word holding entry i
+  uint32_t wordAt(uint16_t i) const {
+    return pgm_read_dword(reinterpret_cast<const uint32_t*>(_data) + (i / ENTRIES_PER_WORD));
+  }
+
+private:
+  const T* _data;
+};
+
+// Entries first, first + 1, ... of a MapTable of ENTRIES entries, one flash read per word.
+//
+//     MapTableStream<uint8_t> x(coordsX, first);
+//     for (uint16_t i = first; i < last; i++) { uint8_t xi = x.next(); ... }
+//
+template <typename T, uint16_t ENTRIES = NUM_PIXELS>
+class MapTableStream {
+  // entries in whole words; any after these are read one at a time, so never past the table's end
+  static const uint16_t WHOLE_WORD_ENTRIES = ENTRIES - (ENTRIES % MapTable<T>::ENTRIES_PER_WORD);
+
+public:
+  MapTableStream(const MapTable<T>& table, uint16_t first = 0)
+    : _table(table), _index(first), _word((first < WHOLE_WORD_ENTRIES) ? table.wordAt(first) : 0) {}
+
+  T next() {
+    if (_index >= WHOLE_WORD_ENTRIES) {
+      return _table[_index++];
+    }
+    const uint8_t lane = _index % MapTable<T>::ENTRIES_PER_WORD;
+    const T value = static_cast<T>(_word >> (8 * sizeof(T) * lane)); // both targets are little-endian
+    _index++;
+    if ((lane == MapTable<T>::ENTRIES_PER_WORD - 1) && (_index < WHOLE_WORD_ENTRIES)) {
+      _word = _table.wordAt(_index);
+    }
+    return value;
+  }
+
+private:
+  const MapTable<T> _table;
+  uint16_t _index;
+  uint32_t _word;
+};
+
+#endif
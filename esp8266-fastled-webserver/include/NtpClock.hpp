@@ -0,0 +1,66 @@
+#pragma once
+#if !defined(NTP_CLOCK_HPP)
+#define NTP_CLOCK_HPP
+
+// Time of day for the clock patterns, kept in step with NTP_SERVER (SNTP over UDP).
+//
+// update() is a state machine that never waits on the network: each call does
+// at most one step (start a DNS lookup, send a request, or check for the reply),
+// and gives up on a step after a timeout.  Failed requests are retried after
+// 15 seconds, doubling up to NTP_UPDATE_THROTTLE_MILLLISECONDS.
+//
+// The first reply sets the clock.  Later replies that differ by less than a
+// second are slewed in over a minute, so the clock hands never jump.
+//
+// update() and setTimeOffset() are for the network task; the getters are for the
+// render task.  Until the first reply (or always, when ENABLE_NTP is zero), the
+// time counts from 00:00:00 at boot.
+class NtpClock {
+public:
+  void begin(const char* server = NTP_SERVER);
+  void update();
+  void setTimeOffset(int32_t seconds);
+
+  bool isTimeSet();
+  uint32_t getEpochTime(); // seconds since 1970, local time
+  uint8_t getHours();
+  uint8_t getMinutes();
+  uint8_t getSeconds();
+
+  // Fields of one getEpochTime() sample, so that they agree with each other
+  static uint8_t hoursOf(uint32_t epochTime)   { return (epochTime % 86400L) / 3600; }
+  static uint8_t minutesOf(uint32_t epochTime) { return (epochTime % 3600) / 60; }
+  static uint8_t secondsOf(uint32_t epochTime) { return epochTime % 60; }
+
+  // The render task's view of the clock, published by the network task
+  struct TimeBase {
+    uint64_t epochMillis; // UTC, at atMillis
+    uint32_t atMillis;    // millis() when epochMillis was measured
+    int32_t  slewMillis;  // correction still being applied, over SLEW_MILLIS from atMillis
+    int32_t  offsetSeconds;
+    bool     valid;
+  };
+
+private:
+  enum State : uint8_t { IDLE, RESOLVING, WAITING };
+
+  void startRequest(uint32_t now);
+  void sendRequest(uint32_t now);
+  void receiveReply(uint32_t now);
+  void retryLater(uint32_t now);
+  void publish(const TimeBase& base);
+  uint64_t localEpochMillis();
+
+  const char* _server = nullptr;
+  State _state = IDLE;
+  uint32_t _stateMillis = 0;    // when the current step started
+  uint32_t _nextRequestMillis = 0;
+  uint32_t _retryMillis = 0;    // zero after a successful update
+  uint32_t _requestNonce = 0;   // echoed back by the server
+  TimeBase _published = {};     // the network task's copy of the published value
+  ParameterSnapshot<TimeBase> _snapshot;
+};
+
+extern NtpClock ntpClock;
+
+#endif
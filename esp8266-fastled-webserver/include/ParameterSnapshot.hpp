@@ -0,0 +1,52 @@
+#pragma once
+#if !defined(PARAMETER_SNAPSHOT_HPP)
+#define PARAMETER_SNAPSHOT_HPP
+
+#include <atomic>
+#include <stdint.h>
+
+// Hands a small, trivially copyable struct from one task to another
+// (e.g., from the network core to the render core) without locks.
+//
+// Exactly one task may call publish(), and exactly one task may call acquire().
+// Neither side ever waits for the other:
+// * the writer fills its private slot, then swaps it with the shared slot
+// * the reader swaps its private slot with the shared slot, but only when
+//   a newer value has been published since its last acquire()
+//
+// Each side always owns one slot, with a third slot in flight between them,
+// so the reader never observes a partially written value.  The reference
+// returned by acquire() remains valid until the next call to acquire().
+template <typename T>
+class ParameterSnapshot {
+public:
+  explicit ParameterSnapshot(const T& initial = T())
+    : _slots{ initial, initial, initial }, _shared(1), _writeIndex(0), _readIndex(2) {}
+
+  // writer side
+  void publish(const T& value) {
+    _slots[_writeIndex] = value;
+    uint8_t previous = _shared.exchange(_writeIndex | FRESH, std::memory_order_acq_rel);
+    _writeIndex = previous & INDEX_MASK;
+  }
+
+  // reader side
+  const T& acquire() {
+    if (_shared.load(std::memory_order_relaxed) & FRESH) {
+      uint8_t previous = _shared.exchange(_readIndex, std::memory_order_acq_rel);
+      _readIndex = previous & INDEX_MASK;
+    }
+    return _slots[_readIndex];
+  }
+
+private:
+  static const uint8_t INDEX_MASK = 0x03;
+  static const uint8_t FRESH      = 0x04;
+
+  T _slots[3];
+  std::atomic<uint8_t> _shared; // index of the in-flight slot, plus FRESH flag
+  uint8_t _writeIndex;          // only touched by the writer
+  uint8_t _readIndex;           // only touched by the reader
+};
+
+#endif
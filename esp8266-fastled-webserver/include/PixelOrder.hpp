@@ -0,0 +1,87 @@
+#pragma once
+#if !defined(PIXEL_ORDER_HPP)
+#define PIXEL_ORDER_HPP
+
+// Mapping from a pattern's logical pixel index (the order in which it computes
+// colors) to the physical index in leds[].  The flags compose: the index is first
+// mapped through fibonacciToPhysical[], then mirrored.  For example, Pride on a
+// Fibonacci product writes logical pixel i to (NUM_PIXELS - 1) - fibonacciToPhysical[i].
+enum PixelOrder : uint8_t {
+  PIXEL_ORDER_LINEAR    = 0,
+  PIXEL_ORDER_FIBONACCI = 1 << 0, // radial (vogel spiral) order; IS_FIBONACCI only
+  PIXEL_ORDER_REVERSED  = 1 << 1, // (NUM_PIXELS - 1) - i
+  PIXEL_ORDER_REVERSED_FIBONACCI = PIXEL_ORDER_FIBONACCI | PIXEL_ORDER_REVERSED,
+};
+
+constexpr PixelOrder operator|(PixelOrder a, PixelOrder b) {
+  return static_cast<PixelOrder>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
+inline uint16_t physicalPixelIndex(PixelOrder order, uint16_t i) {
+#if IS_FIBONACCI
+  if (order & PIXEL_ORDER_FIBONACCI) {
+    i = fibonacciToPhysical[i];
+  }
+#endif
+  if (order & PIXEL_ORDER_REVERSED) {
+    i = (NUM_PIXELS - 1) - i;
+  }
+  return i;
+}
+
+// When LOGICAL_RENDER_BUFFER is enabled, patterns using LogicalPixels write to a
+// separate buffer in logical order, and renderFrame() permutes it into leds[] in
+// a single pass (outputLogicalPixels()) after the pattern returns.
+#if LOGICAL_RENDER_BUFFER
+  CRGB* beginLogicalFrame(PixelOrder order);
+  void outputLogicalPixels();
+  void invalidateLogicalPixels();
+#else
+  inline void outputLogicalPixels() {}
+  inline void invalidateLogicalPixels() {}
+#endif
+
+// Pixels of the current frame, indexed in a pattern's logical order.
+//
+// The order is a template parameter, so each pattern gets a loop specialized
+// for its order, without per-pixel checks.
+//
+// Construct once per frame, before any forEachPixelRange() kernel uses it.
+// With LOGICAL_RENDER_BUFFER, writes are sequential, and the buffer starts out
+// holding the frame currently in leds[] (so patterns may blend into it).
+// Otherwise, each access is remapped into leds[] directly.
+template <PixelOrder ORDER>
+class LogicalPixels {
+  static_assert(IS_FIBONACCI || !(ORDER & PIXEL_ORDER_FIBONACCI), "PIXEL_ORDER_FIBONACCI requires IS_FIBONACCI");
+
+public:
+#if LOGICAL_RENDER_BUFFER
+  LogicalPixels() : _pixels(beginLogicalFrame(ORDER)) {}
+#else
+  LogicalPixels() : _pixels(leds) {}
+#endif
+
+  CRGB& operator[](uint16_t i) const {
+#if LOGICAL_RENDER_BUFFER
+    return _pixels[i];
+#else
+    return _pixels[physicalPixelIndex(ORDER, i)];
+#endif
+  }
+
+  // All NUM_PIXELS pixels, for operations that treat every pixel alike (e.g., fading)
+  CRGB* data() const { return _pixels; }
+
+  // +1 (or -1) when logical pixel i + 1 directly follows (or precedes) pixel i in data(), otherwise 0
+  static constexpr int8_t rowDirection() {
+    return LOGICAL_RENDER_BUFFER            ?  1 :
+           (ORDER == PIXEL_ORDER_LINEAR)    ?  1 :
+           (ORDER == PIXEL_ORDER_REVERSED)  ? -1 :
+                                               0 ;
+  }
+
+private:
+  CRGB* _pixels;
+};
+
+#endif
@@ -0,0 +1,93 @@
+#pragma once
+#if !defined(SWAR_KERNELS_HPP)
+#define SWAR_KERNELS_HPP
+
+// Array versions of FastLED's nscale8(), fadeToBlackBy() and nblend(),
+// which work on the color bytes of a CRGB array four at a time.
+//
+// Each 32-bit word is split into two words of 16-bit lanes (even and odd bytes),
+// so one multiply scales two bytes at once.  No lane can carry into its neighbor:
+// scaling is at most 255 * 256, and blending at most 255 * (256 - a) + 255 * (a + 1),
+// both of which fit in 16 bits.
+//
+// Results are byte-for-byte identical to FastLED (with FASTLED_SCALE8_FIXED and
+// FASTLED_BLEND_FIXED, the defaults).  When SWAR_PIXEL_KERNELS is 0, these simply
+// call the FastLED functions.
+
+// Word access to packed bytes (e.g., the color bytes of a CRGB array).  Xtensa cannot
+// load or store unaligned words, so only use this on 4-byte aligned addresses.
+typedef uint32_t __attribute__((__may_alias__)) packed_word_t;
+
+void nscale8Packed(CRGB* leds, uint16_t count, uint8_t scale);
+
+inline void fadeToBlackByPacked(CRGB* leds, uint16_t count, uint8_t fadeBy) {
+  nscale8Packed(leds, count, 255 - fadeBy);
+}
+
+// existing[i] = nblend(existing[i], overlay[i], amountOfOverlay)
+//
+// The word-at-a-time path is only used when both arrays have the same alignment
+// (modulo four bytes); otherwise, each byte is blended separately.
+void nblendPacked(CRGB* existing, const CRGB* overlay, uint16_t count, fract8 amountOfOverlay);
+
+// Several patterns compute one color per logical pixel i, in increasing order,
+// and nblend() it into the pixel LogicalPixels maps i to.  This collects those
+// colors (for a contiguous range of i, starting at first) and, where the pixels
+// are adjacent in memory (in either direction), blends them in with nblendPacked(),
+// a chunk at a time.  Other orders are blended one pixel at a time.
+// Call flush() after the last push().
+template <PixelOrder ORDER>
+class RowBlender {
+public:
+  RowBlender(const LogicalPixels<ORDER>& target, uint16_t first, fract8 amountOfOverlay)
+    : _target(target), _first(first), _amount(amountOfOverlay), _count(0) {
+    // Keep the overlay buffer at the same alignment as the pixels it is blended into.
+    // Each chunk is a multiple of four bytes, so this holds for every chunk.
+    uintptr_t alignment = 0;
+    if (_direction > 0) {
+      alignment = reinterpret_cast<uintptr_t>(_target.data() + first) & 3;
+    } else if (_direction < 0) {
+      alignment = reinterpret_cast<uintptr_t>(_target.data() + (NUM_PIXELS - first)) & 3;
+    }
+    _overlay = reinterpret_cast<CRGB*>(_buffer + alignment);
+  }
+
+  void push(const CRGB& color) {
+    if (_direction == 0) {
+      nblend(_target[_first++], color, _amount);
+      return;
+    }
+    // when reversed, fill the buffer from the end, so it matches the order in memory
+    _overlay[(_direction > 0) ? _count : ((CHUNK - 1) - _count)] = color;
+    _count++;
+    if (_count == CHUNK) {
+      flush();
+    }
+  }
+
+  void flush() {
+    if (_count == 0) return;
+    if (_direction > 0) {
+      nblendPacked(&_target[_first], _overlay, _count, _amount);
+    } else {
+      nblendPacked(&_target[_first + _count - 1], _overlay + (CHUNK - _count), _count, _amount);
+    }
+    _first += _count;
+    _count = 0;
+  }
+
+private:
+  static const uint8_t CHUNK = 16; // pixels; must be a multiple of four
+  static_assert(((sizeof(CRGB) * CHUNK) & 3) == 0, "");
+
+  static const int8_t _direction = LogicalPixels<ORDER>::rowDirection();
+
+  const LogicalPixels<ORDER>& _target;
+  uint16_t _first; // next logical pixel to be blended
+  CRGB* _overlay;
+  fract8 _amount;
+  uint8_t _count;
+  alignas(4) uint8_t _buffer[sizeof(CRGB) * CHUNK + 3];
+};
+
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+#if !defined(TRANSFERS_HPP)
+#define TRANSFERS_HPP
+
+// Sends the body of a static file response a chunk at a time, across many loop
+// iterations, so that a large file (e.g., bootstrap.min.css) does not stop the
+// animation while it is sent.
+//
+// The handler sends the status line and headers, with the Content-Length, as
+// usual, then hands the body to one of a few transfer slots, which keeps its own
+// reference to the connection.  A chunk is at most TRANSFER_CHUNK_BYTES, and
+// never more than the connection takes without waiting.  The first chunk is
+// sent right away, so a small file is done before the handler returns.
+//
+// The rest is sent by pumpTransfers(): at least one chunk, and for up to
+// TRANSFER_LOOP_MICROS, per handleNetwork(), so a transfer progresses even when
+// frames overrun; and, with the energy governor, in the time it would otherwise
+// sleep before the next frame is due.  Each call also drops the transfers of
+// clients that are gone, or that took nothing for a few seconds.
+//
+// When every slot is busy, or with RENDER_TASK_ON_SEPARATE_CORE (where sending
+// never delays a frame), the body is sent at once, as before.
+
+#define TRANSFER_LOOP_MICROS 1000 // sent per handleNetwork(), besides the governor's sleep
+
+void transferFile(File& file);                  // takes over the open file, from its current position
+void transferFlash(PGM_P data, uint32_t size);  // data must be PROGMEM (stays valid)
+
+// Sends chunks round-robin, until budgetMicros have passed (at least one chunk),
+// or no transfer can make progress without waiting for the network.
+void pumpTransfers(uint32_t budgetMicros);
+bool transfersPending();
+
+#endif
@@ -0,0 +1,78 @@
+#pragma once
+#if !defined(WAVE_KERNELS_HPP)
+#define WAVE_KERNELS_HPP
+
+// Per-pixel helpers shared by Pride, color waves and their playground versions.
+// Each is constructed once per frame, before the pixel loop, and uses a table
+// that is only rebuilt when its input changes.  Only one pattern runs at a time,
+// so all instances share the same table.  The tables are allocated on the heap
+// by the first frame that uses them, and freed by releaseWaveTables() when the
+// pattern changes; if the heap is short, each value is computed instead.
+//
+// The inputs of the tables may change every frame, and rebuilding one costs about
+// as much as computing 256 pixels, so products with fewer than 256 pixels compute
+// every value instead (as the coordinate palette patterns do; see Map.cpp).
+
+// Brightness of the waves, as a function of the 16-bit phase:
+//
+//     b16  = sin16(theta) + 32768
+//     bri8 = ((b16 * b16 / 65536) * depth / 65536) + (255 - depth)
+//
+// Tabulated at 256 phases, and linearly interpolated in between.
+// The result is within 2 of the exact value (and equal to it for ~88% of phases).
+class BrightnessWave {
+public:
+  explicit BrightnessWave(uint8_t depth);
+
+  // the exact value, which the table holds at multiples of 256
+  static uint8_t exact(uint16_t theta, uint8_t depth) {
+    uint16_t b16 = sin16(theta) + 32768;
+    uint16_t bri16 = (uint32_t)((uint32_t)b16 * (uint32_t)b16) / 65536;
+    uint8_t bri8 = (uint32_t)(((uint32_t)bri16) * depth) / 65536;
+    return bri8 + (255 - depth);
+  }
+
+  uint8_t operator()(uint16_t theta) const {
+    if (_table == nullptr) {
+      return exact(theta, _depth);
+    }
+    const uint8_t i = theta >> 8;
+    const int16_t a = _table[i];
+    const int16_t b = _table[(uint8_t)(i + 1)];
+    return a + (((b - a) * (int32_t)(theta & 0xFF) + 128) >> 8);
+  }
+
+private:
+  const uint8_t* _table;
+  uint8_t _depth;
+};
+
+// CRGB(CHSV(hue, sat, val)) for a fixed saturation, using a table of all
+// 256 hues at full value.  hsv2rgb_rainbow() applies value last, by scaling
+// with scale8_video(val, val), so the result is identical to the conversion.
+class RainbowTable {
+public:
+  explicit RainbowTable(uint8_t sat);
+
+  CRGB operator()(uint8_t hue, uint8_t val) const {
+    if (_table == nullptr) {
+      CRGB rgb;
+      hsv2rgb_rainbow(CHSV(hue, _sat, val), rgb);
+      return rgb;
+    }
+    CRGB rgb = _table[hue];
+    if (val != 255) {
+      rgb.nscale8(scale8_video(val, val));
+    }
+    return rgb;
+  }
+
+private:
+  const CRGB* _table;
+  uint8_t _sat;
+};
+
+// Frees both tables; called whenever the pattern changes
+void releaseWaveTables();
+
+#endif
@@ -0,0 +1,31 @@
+#pragma once
+#if !defined(WEB_ASSETS_HPP)
+#define WEB_ASSETS_HPP
+
+// With EMBED_WEB_ASSETS, the web app (data/) is compiled into the firmware by
+// pio-scripts/embed-web-assets.py, gzipped, with a table sorted by path.  Such
+// files are sent straight from flash, and need neither LittleFS nor deployapp.sh.
+// A file of the same name on the file system still takes precedence, so the
+// app can be changed without reflashing.  A download (?download) gets the bytes
+// as stored, gzipped, as it does for a .gz file on LittleFS.
+//
+// The bundle costs about 400 KB of flash; on ESP8266, the build fails when the
+// firmware no longer leaves room for an OTA update (see embed-web-assets.py).
+
+struct WebAsset {
+  uint16_t pathOffset; // into webAssetPaths
+  uint32_t offset;     // into webAssetData, a multiple of four
+  uint32_t size;       // bytes sent
+  uint32_t hash;       // FNV-1a of the bytes sent
+  bool     gzipped;
+};
+
+#if EMBED_WEB_ASSETS
+  bool serveWebAsset(const String& path); // false when path is not in the bundle
+  uint16_t webAssetCount();
+#else
+  inline bool serveWebAsset(const String&) { return false; }
+  inline uint16_t webAssetCount() { return 0; }
+#endif
+
+#endif
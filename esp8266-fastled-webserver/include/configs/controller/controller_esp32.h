@@ -21,15 +21,16 @@
 #define ESP8266_FASTLED_WEBSERVER_CONTROLLER_ESP32_H
 
 
-// Would need to define (and use) the additional DATA_PIN_x symbols,
-// and update the corresponding code using those symbols.
-static_assert(PARALLEL_OUTPUT_CHANNELS <= 4, "While ESP32 supports 16 parallel outputs, currently only support four parallel outputs");
+static_assert(PARALLEL_OUTPUT_CHANNELS <= 16, "ESP32 only supports sixteen parallel outputs");
 
-// TODO: consider using I2S (instead of RMT) on the ESP32:
-//
-// #define FASTLED_ESP32_I2S true
+// All channels are refreshed concurrently, so show() takes only as long as the
+// longest channel.  The RMT peripheral has eight channels; beyond that, use
+// the I2S peripheral, which drives up to 24 outputs in parallel.
 //
 // See https://github.com/FastLED/FastLED/issues/1220#issuecomment-822677011
+#if (PARALLEL_OUTPUT_CHANNELS > 8) && !defined(FASTLED_ESP32_I2S)
+   #define FASTLED_ESP32_I2S true
+#endif
 
 #if !defined(DATA_PIN)
    #if PARALLEL_OUTPUT_CHANNELS == 1
@@ -48,9 +49,66 @@ static_assert(PARALLEL_OUTPUT_CHANNELS <= 4, "While ESP32 supports 16 parallel o
 #if !defined(DATA_PIN_4) && PARALLEL_OUTPUT_CHANNELS >= 4
    #define DATA_PIN_4    18 // d1 mini32 (same physical location as D5 on the d1 mini)
 #endif
+// Channels five to twelve use pins that are free on the d1 mini32, avoiding
+// the strapping pins (GPIO 0, 2, 12 and 15), the pins used by PSRAM on WROVER
+// modules (GPIO 16 and 17; 16 is also the default IR_RECV_PIN), the default I2C
+// pins (GPIO 21 and 22), and the serial pins (GPIO 1 and 3).
+#if !defined(DATA_PIN_5) && PARALLEL_OUTPUT_CHANNELS >= 5
+   #define DATA_PIN_5    26
+#endif
+#if !defined(DATA_PIN_6) && PARALLEL_OUTPUT_CHANNELS >= 6
+   #define DATA_PIN_6    25
+#endif
+#if !defined(DATA_PIN_7) && PARALLEL_OUTPUT_CHANNELS >= 7
+   #define DATA_PIN_7    32
+#endif
+#if !defined(DATA_PIN_8) && PARALLEL_OUTPUT_CHANNELS >= 8
+   #define DATA_PIN_8    33
+#endif
+#if !defined(DATA_PIN_9) && PARALLEL_OUTPUT_CHANNELS >= 9
+   #define DATA_PIN_9    27
+#endif
+#if !defined(DATA_PIN_10) && PARALLEL_OUTPUT_CHANNELS >= 10
+   #define DATA_PIN_10   14
+#endif
+#if !defined(DATA_PIN_11) && PARALLEL_OUTPUT_CHANNELS >= 11
+   #define DATA_PIN_11   13
+#endif
+#if !defined(DATA_PIN_12) && PARALLEL_OUTPUT_CHANNELS >= 12
+   #define DATA_PIN_12    4
+#endif
+// No pins are left that are safe on every module, so the board's wiring decides.
+#if PARALLEL_OUTPUT_CHANNELS >= 13
+   #if !defined(DATA_PIN_13) || ((PARALLEL_OUTPUT_CHANNELS >= 14) && !defined(DATA_PIN_14)) || \
+       ((PARALLEL_OUTPUT_CHANNELS >= 15) && !defined(DATA_PIN_15)) || ((PARALLEL_OUTPUT_CHANNELS >= 16) && !defined(DATA_PIN_16))
+      #error "More than twelve channels on ESP32: define DATA_PIN_13 and up explicitly (the remaining pins are strapping, PSRAM or I2C pins on some modules)"
+   #endif
+#endif
+#if !defined(PARALLEL_OUTPUT_BLOCK)
+   #define PARALLEL_OUTPUT_BLOCK 0 // RMT / I2S already send the channels concurrently
+#endif
 
 
 
+// Run the web server / WiFi handling on core 0 (where the WiFi stack already runs),
+// and pattern rendering / LED output on core 1, so that neither stalls the other.
+// Settings reach the renderer via a lock-free snapshot, taken at the start of each frame.
+#if !defined(RENDER_TASK_ON_SEPARATE_CORE)
+   #define RENDER_TASK_ON_SEPARATE_CORE 1
+#endif
+#if !defined(NETWORK_TASK_CORE)
+   #define NETWORK_TASK_CORE 0
+#endif
+#if !defined(RENDER_TASK_CORE)
+   #define RENDER_TASK_CORE  1
+#endif
+
+// Split the larger per-pixel pattern kernels (noise, pride, color waves, twinkles)
+// across both cores, with a worker task on NETWORK_TASK_CORE rendering half the pixels.
+#if !defined(PARALLEL_PIXEL_KERNELS)
+   #define PARALLEL_PIXEL_KERNELS 1
+#endif
+
 #if defined(ENABLE_IR) && !defined(IR_RECV_PIN)
    // Default pin for ESP32 is 16 (for d1 mini32, this is the same physical location as D4 on the d1 mini)
    #define IR_RECV_PIN   16  // TODO: VERIFY THIS IS CORRECT VALUE
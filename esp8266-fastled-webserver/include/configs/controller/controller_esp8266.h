@@ -22,6 +22,27 @@
 
 static_assert(PARALLEL_OUTPUT_CHANNELS <= 6, "ESP8266 only supports six parallel outputs");
 
+#if !defined(PARALLEL_OUTPUT_BLOCK)
+   #define PARALLEL_OUTPUT_BLOCK 0
+#endif
+
+#if PARALLEL_OUTPUT_BLOCK
+   // FastLED's block-clockless output sends lane n on GPIO 12 + n, all lanes at once
+   static_assert(PARALLEL_OUTPUT_CHANNELS <= 4, "ESP8266 block output only supports four lanes (GPIO 12 .. 15)");
+   #if !defined(DATA_PIN)
+      #define DATA_PIN   D6 // d1 mini, GPIO 12
+   #endif
+   #if !defined(DATA_PIN_2) && PARALLEL_OUTPUT_CHANNELS >= 2
+      #define DATA_PIN_2 D7 // d1 mini, GPIO 13
+   #endif
+   #if !defined(DATA_PIN_3) && PARALLEL_OUTPUT_CHANNELS >= 3
+      #define DATA_PIN_3 D5 // d1 mini, GPIO 14
+   #endif
+   #if !defined(DATA_PIN_4) && PARALLEL_OUTPUT_CHANNELS >= 4
+      #define DATA_PIN_4 D8 // d1 mini, GPIO 15 (must be low at boot)
+   #endif
+#endif
+
 #if !defined(DATA_PIN)
    #if PARALLEL_OUTPUT_CHANNELS == 1
       #define DATA_PIN   D5 // d1 mini
@@ -46,6 +67,14 @@ static_assert(PARALLEL_OUTPUT_CHANNELS <= 6, "ESP8266 only supports six parallel
    #define DATA_PIN_6    D2 // d1 mini
 #endif
 
+// single core ... network handling and rendering alternate in loop()
+#if !defined(RENDER_TASK_ON_SEPARATE_CORE)
+   #define RENDER_TASK_ON_SEPARATE_CORE 0
+#endif
+#if !defined(PARALLEL_PIXEL_KERNELS)
+   #define PARALLEL_PIXEL_KERNELS 0
+#endif
+
 #if defined(ENABLE_IR) && !defined(IR_RECV_PIN)
    #define IR_RECV_PIN   D4
 #endif
@@ -63,6 +63,73 @@
    #define PARALLEL_OUTPUT_CHANNELS      1
 #endif
 
+// Multi-channel variants split the disc between whole rings (see rings[] in Map.cpp),
+// feeding each group of rings from its own data pin.  Pixel order is unchanged,
+// so the coordinate maps (and all patterns) are the same as the single-pin build.
+//
+// Only channels that are refreshed concurrently gain frame rate.  On ESP32, with
+// eight channels, the longest chain is 263 pixels (~8ms), instead of 1628 pixels (~49ms).
+// On ESP8266, the channels' controllers are shown one after another, unless
+// PARALLEL_OUTPUT_BLOCK sends them together: that needs four equal lanes of 407
+// pixels (~12ms), so the chain is cut at pixels 407, 814 and 1221, within rings 9,
+// 14 and 17 ... the pixel order, and so the maps, are still those of the single pin.
+#if (PARALLEL_OUTPUT_CHANNELS == 4) && defined(PARALLEL_OUTPUT_BLOCK) && PARALLEL_OUTPUT_BLOCK
+   #if !defined(PIXELS_ON_DATA_PIN_1)
+      #define PIXELS_ON_DATA_PIN_1 407 // rings  0 ..  8, and 74 pixels of ring 9
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_2)
+      #define PIXELS_ON_DATA_PIN_2 407 // rest of ring 9 .. 13, and 11 pixels of ring 14
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_3)
+      #define PIXELS_ON_DATA_PIN_3 407 // rest of ring 14 .. 16, and 40 pixels of ring 17
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_4)
+      #define PIXELS_ON_DATA_PIN_4 407 // rest of ring 17 .. 19
+   #endif
+#elif (PARALLEL_OUTPUT_CHANNELS == 8)
+   #if !defined(PIXELS_ON_DATA_PIN_1)
+      #define PIXELS_ON_DATA_PIN_1 263 // rings  0 ..  7
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_2)
+      #define PIXELS_ON_DATA_PIN_2 234 // rings  8 .. 10
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_3)
+      #define PIXELS_ON_DATA_PIN_3 196 // rings 11 .. 12
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_4)
+      #define PIXELS_ON_DATA_PIN_4 228 // rings 13 .. 14
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_5)
+      #define PIXELS_ON_DATA_PIN_5 260 // rings 15 .. 16
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_6)
+      #define PIXELS_ON_DATA_PIN_6 142 // ring  17
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_7)
+      #define PIXELS_ON_DATA_PIN_7 145 // ring  18
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_8)
+      #define PIXELS_ON_DATA_PIN_8 160 // ring  19
+   #endif
+#elif (PARALLEL_OUTPUT_CHANNELS == 4)
+   #if !defined(PIXELS_ON_DATA_PIN_1)
+      #define PIXELS_ON_DATA_PIN_1 411 // rings  0 ..  9
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_2)
+      #define PIXELS_ON_DATA_PIN_2 392 // rings 10 .. 13
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_3)
+      #define PIXELS_ON_DATA_PIN_3 378 // rings 14 .. 16
+   #endif
+   #if !defined(PIXELS_ON_DATA_PIN_4)
+      #define PIXELS_ON_DATA_PIN_4 447 // rings 17 .. 19
+   #endif
+#elif (PARALLEL_OUTPUT_CHANNELS != 1)
+   // Other splits are allowed, but must define PIXELS_ON_DATA_PIN_n for each channel,
+   // and each channel must be a whole number of rings (enforced in Map.cpp), or,
+   // with PARALLEL_OUTPUT_BLOCK, the same number of pixels (enforced in ChannelLayout.hpp).
+#endif
+
 
 
 
@@ -101,10 +101,11 @@
 // and the inverse mapping from Vogel order back to physical pixel index.
 // IS_FIBONACCI also implies HAS_COORDINATE_MAP.
 //
-// When this is true, the following must be defined in map.h:
+// When this is true, the following must be defined in Map.cpp
+// (in flash, see include/MapTable.hpp):
 //
-// const uint8_t physicalToFibonacci[NUM_PIXELS];
-// const uint8_t fibonacciToPhysical[NUM_PIXELS];
+// const uint8_t physicalToFibonacci_p[NUM_PIXELS] MAP_TABLE_PROGMEM;
+// const uint8_t fibonacciToPhysical_p[NUM_PIXELS] MAP_TABLE_PROGMEM;
 //
 // NOTE: physicalToFibonacci[] and fibonacciToPhysical[] are uint16_t when
 //       NUM_PIXELS is greater than 256.
@@ -115,11 +116,12 @@
 // HAS_COORDINATE_MAP is true when there are mappings to define
 // both the X,Y coordinates and the angles for each pixel.
 //
-// When this is true, the following must be defined in map.h:
+// When this is true, the following must be defined in Map.cpp
+// (in flash, see include/MapTable.hpp):
 //
-// const uint8_t coordsX[NUM_PIXELS];
-// const uint8_t coordsY[NUM_PIXELS];
-// const uint8_t angles[NUM_PIXELS];
+// const uint8_t coordsX_p[NUM_PIXELS] MAP_TABLE_PROGMEM;
+// const uint8_t coordsY_p[NUM_PIXELS] MAP_TABLE_PROGMEM;
+// const uint8_t angles_p[NUM_PIXELS] MAP_TABLE_PROGMEM;
 #if !defined(HAS_COORDINATE_MAP)
    #define HAS_COORDINATE_MAP            1
 #endif
@@ -136,7 +138,9 @@
 // ...
 // #define PIXELS_ON_DATA_PIN_n zc
 //
-// *AND* the controller must support the required number of channels.
+// *AND* the controller must support the required number of channels
+// (ESP8266: up to 6, ESP32: up to 16).  The sum of the PIXELS_ON_DATA_PIN_n
+// values must equal NUM_PIXELS.
 //
 // The controller header file will define default values for the data pins,
 // by defining the following symbols:
@@ -0,0 +1,190 @@
+# Gzips the web app (data/) into a bundle compiled into the firmware, for
+# builds with EMBED_WEB_ASSETS=1 (see include/WebAssets.hpp).
+#
+# As a PlatformIO pre: script, it regenerates the bundle before each build whose
+# build_flags define EMBED_WEB_ASSETS=1 (a #define in a config header is not
+# seen here), and before the native tests (HOST_UNIT_TEST), which include it.
+# Arduino IDE users run it by hand, from the repository root, after changing
+# anything in data/:
+#
+#     python3 pio-scripts/embed-web-assets.py
+#
+# The bundle is include/generated/WebAssets.h: one PROGMEM array holding every
+# file, gzipped unless that does not make it smaller, and a table of
+# { path, offset, size, hash, gzipped } sorted by path for binary search.
+# The file is only rewritten when its content changes, so unchanged assets do
+# not cause a rebuild.
+#
+# The bundle costs about 400 KB of flash.  On ESP8266, an OTA update is written
+# between the running sketch and the file system, so the firmware must fit in
+# half of that space; the build fails when it does not (check_ota_size()).  On
+# ESP32, each OTA partition holds a whole firmware, and PlatformIO's own size
+# check against the app partition covers it.
+
+import gzip
+import os
+import re
+import sys
+
+SKIP = {'.DS_Store', 'Thumbs.db'}
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def collect(data_dir):
+    assets = []
+    for root, dirs, files in os.walk(data_dir):
+        dirs.sort()
+        for name in sorted(files):
+            if name in SKIP:
+                continue
+            full = os.path.join(root, name)
+            path = '/' + os.path.relpath(full, data_dir).replace(os.sep, '/')
+            with open(full, 'rb') as f:
+                content = f.read()
+            if path.endswith('.gz'):
+                # already compressed; served as the file without .gz
+                assets.append((path[:-3], content, True))
+                continue
+            packed = gzip.compress(content, compresslevel=9, mtime=0)
+            if len(packed) < len(content):
+                assets.append((path, packed, True))
+            else:
+                assets.append((path, content, False))
+    # a pre-compressed file wins over the plain one, as on the file system
+    unique = {}
+    for path, content, gzipped in assets:
+        if path not in unique or gzipped:
+            unique[path] = (content, gzipped)
+    # byte order, matching strcmp() on the device
+    return [(path,) + unique[path] for path in sorted(unique, key=lambda p: p.encode())]
+
+
+def render(assets):
+    lines = [
+        '// Generated by pio-scripts/embed-web-assets.py from data/ -- do not edit',
+        '#pragma once',
+        '',
+        '#define WEB_ASSET_COUNT %d' % len(assets),
+        '',
+    ]
+    paths = b''
+    path_offsets = []
+    for path, _, _ in assets:
+        path_offsets.append(len(paths))
+        paths += path.encode() + b'\0'
+    lines.append('static const char webAssetPaths[] PROGMEM =')
+    for path, _, _ in assets:
+        lines.append('  "%s\\0"' % path)
+    lines.append(';')
+    lines.append('')
+
+    data = b''
+    table = []
+    for (path, content, gzipped), path_offset in zip(assets, path_offsets):
+        table.append((path_offset, len(data), len(content), fnv1a(content), gzipped, path))
+        data += content
+        data += b'\0' * (-len(data) % 4)
+    lines.append('static const uint8_t webAssetData[%d] PROGMEM __attribute__((aligned(4))) = {' % max(len(data), 1))
+    for i in range(0, len(data), 24):
+        lines.append('  ' + ','.join('0x%02X' % b for b in data[i:i + 24]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('static const WebAsset webAssets[WEB_ASSET_COUNT] PROGMEM = {')
+    for path_offset, offset, size, hash_, gzipped, path in table:
+        lines.append('  { %5d, %7d, %7d, 0x%08X, %-5s }, // %s' % (path_offset, offset, size, hash_, 'true' if gzipped else 'false', path))
+    lines.append('};')
+    lines.append('')
+    return '\n'.join(lines), len(data)
+
+
+def generate(project_dir):
+    sketch_dir = os.path.join(project_dir, 'esp8266-fastled-webserver')
+    data_dir = os.path.join(sketch_dir, 'data')
+    output = os.path.join(sketch_dir, 'include', 'generated', 'WebAssets.h')
+    assets = collect(data_dir)
+    text, size = render(assets)
+    os.makedirs(os.path.dirname(output), exist_ok=True)
+    if os.path.exists(output):
+        with open(output) as f:
+            if f.read() == text:
+                return
+    with open(output, 'w') as f:
+        f.write(text)
+    print('embed-web-assets: %d files, %d bytes -> %s' % (len(assets), size, os.path.relpath(output, project_dir)))
+
+
+SKETCH_START = 0x40200000  # flash as mapped on ESP8266
+FLASH_SECTOR = 4096
+
+
+def ota_limit(ldscript):
+    """Largest firmware an OTA update can replace, from the ESP8266 linker script."""
+    with open(ldscript) as f:
+        match = re.search(r'_(?:FS|SPIFFS)_start\s*=\s*(0x[0-9A-Fa-f]+)', f.read())
+    if not match:
+        return None
+    # Updater puts the new firmware, sector-aligned, below the file system and
+    # above the running one
+    return (int(match.group(1), 16) - SKETCH_START) // 2 // FLASH_SECTOR * FLASH_SECTOR
+
+
+def check_ota_size(source, target, env):
+    firmware = os.path.getsize(str(target[0]))
+    ldscript = env.GetActualLDScript()
+    limit = ota_limit(ldscript)
+    if limit is None:
+        print('embed-web-assets: no file system start in %s, OTA size not checked' % ldscript)
+        return 0
+    print('embed-web-assets: firmware %d bytes, OTA limit %d bytes (%s)' % (firmware, limit, os.path.basename(ldscript)))
+    if firmware > limit:
+        print('embed-web-assets: too large for an OTA update by %d bytes; build without '
+              'EMBED_WEB_ASSETS, or with a layout leaving more room for the sketch' % (firmware - limit))
+        return 1
+    return 0
+
+
+def build_defines(env):
+    """The -D flags of the environment's build_flags.
+
+    A pre: script runs before PlatformIO has turned build_flags into CPPDEFINES,
+    so they are parsed here, as PlatformIO will (PLATFORMIO_BUILD_FLAGS too).
+    """
+    flags = env.GetProjectOption('build_flags', [])
+    if isinstance(flags, str):
+        flags = [flags]
+    flags = list(flags) + [os.environ.get('PLATFORMIO_BUILD_FLAGS', '')]
+    return env.ParseFlags(flags).get('CPPDEFINES', [])
+
+
+def defined(defines, name):
+    """The value of a define: None when absent, '' when defined without one."""
+    for define in defines:
+        if isinstance(define, (list, tuple)) and define[0] == name:
+            return '' if len(define) < 2 or define[1] is None else str(define[1])
+        if define == name:
+            return ''
+    return None
+
+
+def embedding_enabled(defines):
+    value = defined(defines, 'EMBED_WEB_ASSETS')
+    return (value is not None) and (value != '0')
+
+
+if 'Import' in globals():
+    Import('env')  # noqa: F821 -- defined when run by PlatformIO
+    defines = build_defines(env)  # noqa: F821
+    if embedding_enabled(defines):
+        generate(env['PROJECT_DIR'])  # noqa: F821
+        if env.get('PIOPLATFORM') == 'espressif8266':  # noqa: F821
+            env.AddPostAction('$BUILD_DIR/${PROGNAME}.bin', check_ota_size)  # noqa: F821
+    elif defined(defines, 'HOST_UNIT_TEST') is not None:
+        generate(env['PROJECT_DIR'])  # noqa: F821 -- for the tests of the bundle
+elif __name__ == '__main__':
+    generate(os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0]))))
@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+# Convert a CSV pixel layout into the binary layout file loaded by the firmware
+# at boot (/layout.bin), and validate existing layout files.  The format is
+# documented in esp8266-fastled-webserver/include/LayoutFile.hpp.
+#
+# The CSV has a header row, and one row per pixel in physical (wiring) order:
+#
+#   x, y         required; any units, translated and scaled into [0 .. 255]
+#                the same way as the built-in maps (see Map.cpp), unless --no-scale
+#   angle        optional; 256 units == 360 degrees (default: around the center)
+#   radius       optional; [0 .. 255] (default: distance from the center)
+#   fibonacci    optional; the pixel's index in spiral (radial) order, i.e. physicalToFibonacci[]
+#   neighbors    optional; space-separated physical indices of adjacent pixels
+#   ring         optional; ring number, with each ring's pixels wired consecutively
+#
+# Without a fibonacci column, --fibonacci orders the pixels by radius, then angle.
+#
+# Examples:
+#   python3 scripts/layout-tool.py build layout.csv -o layout.bin --fibonacci
+#   python3 scripts/layout-tool.py check layout.bin --pixels 256
+#   python3 scripts/layout-tool.py dump layout.bin > layout.csv   (rebuild with --no-scale)
+#   curl --form "file=@layout.bin;filename=layout.bin" http://<device>/edit   (then reboot)
+
+import argparse
+import csv
+import math
+import struct
+import sys
+
+MAGIC = b"LAYT"
+VERSION = 1
+HEADER = struct.Struct("<4sBBBBHH")
+HAS_FIBONACCI = 1 << 0
+HAS_NEIGHBORS = 1 << 1
+HAS_RINGS = 1 << 2
+NO_NEIGHBOR = 0xFFFF
+
+
+class LayoutError(Exception):
+    pass
+
+
+def padded(data):
+    return data + bytes(-len(data) % 4)
+
+
+def index_format(pixels):
+    return "H" if pixels > 256 else "B"
+
+
+def check_permutation(name, values, pixels):
+    if sorted(values) != list(range(pixels)):
+        raise LayoutError("{} must list each index 0 .. {} exactly once".format(name, pixels - 1))
+
+
+def check_layout(layout):
+    pixels = len(layout["coordsX"])
+    if not 1 <= pixels <= 0xFFFF:
+        raise LayoutError("pixel count must be 1 .. 65535")
+    for name in ("coordsX", "coordsY", "angles", "radius"):
+        if len(layout[name]) != pixels:
+            raise LayoutError("{} has {} entries, expected {}".format(name, len(layout[name]), pixels))
+        if any(not 0 <= v <= 255 for v in layout[name]):
+            raise LayoutError("{} values must be 0 .. 255".format(name))
+    if layout.get("physicalToFibonacci") is not None:
+        check_permutation("physicalToFibonacci", layout["physicalToFibonacci"], pixels)
+        for physical, n in enumerate(layout["physicalToFibonacci"]):
+            if layout["fibonacciToPhysical"][n] != physical:
+                raise LayoutError("fibonacciToPhysical is not the inverse of physicalToFibonacci")
+    if layout.get("neighbors") is not None:
+        for i, adjacent in enumerate(layout["neighbors"]):
+            for j in adjacent:
+                if j != NO_NEIGHBOR and not (0 <= j < pixels and j != i):
+                    raise LayoutError("pixel {} has invalid neighbor {}".format(i, j))
+    if layout.get("rings") is not None:
+        expected_first = 0
+        for ring, (first, last) in enumerate(layout["rings"]):
+            if first != expected_first or last < first:
+                raise LayoutError("ring {} must start at pixel {}, and end at or after it".format(ring, expected_first))
+            expected_first = last + 1
+        if expected_first != pixels:
+            raise LayoutError("rings must cover every pixel")
+
+
+def encode(layout):
+    check_layout(layout)
+    pixels = len(layout["coordsX"])
+    flags, per_pixel, ring_count = 0, 0, 0
+    body = b"".join(padded(bytes(layout[name])) for name in ("coordsX", "coordsY", "angles", "radius"))
+    if layout.get("physicalToFibonacci") is not None:
+        flags |= HAS_FIBONACCI
+        for name in ("physicalToFibonacci", "fibonacciToPhysical"):
+            body += padded(struct.pack("<{}{}".format(pixels, index_format(pixels)), *layout[name]))
+    if layout.get("neighbors") is not None:
+        flags |= HAS_NEIGHBORS
+        per_pixel = max(len(adjacent) for adjacent in layout["neighbors"])
+        if per_pixel > 255:
+            raise LayoutError("at most 255 neighbors per pixel")
+        values = [j for adjacent in layout["neighbors"] for j in adjacent + [NO_NEIGHBOR] * (per_pixel - len(adjacent))]
+        body += padded(struct.pack("<{}H".format(len(values)), *values))
+    if layout.get("rings") is not None:
+        flags |= HAS_RINGS
+        ring_count = len(layout["rings"])
+        body += padded(struct.pack("<{}H".format(2 * ring_count), *[v for ring in layout["rings"] for v in ring]))
+    return HEADER.pack(MAGIC, VERSION, flags, per_pixel, 0, pixels, ring_count) + body
+
+
+def decode(data):
+    if len(data) < HEADER.size:
+        raise LayoutError("truncated header")
+    magic, version, flags, per_pixel, reserved, pixels, ring_count = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise LayoutError("not a layout file")
+    if version != VERSION:
+        raise LayoutError("unsupported version {}".format(version))
+    if reserved != 0 or flags & ~(HAS_FIBONACCI | HAS_NEIGHBORS | HAS_RINGS):
+        raise LayoutError("reserved header bits are set")
+    offset = HEADER.size
+    layout = {}
+
+    def take(count, fmt):
+        nonlocal offset
+        size = struct.calcsize("<{}{}".format(count, fmt))
+        if offset + size > len(data):
+            raise LayoutError("file size does not match header")
+        values = list(struct.unpack_from("<{}{}".format(count, fmt), data, offset))
+        offset += size + (-size % 4)
+        return values
+
+    for name in ("coordsX", "coordsY", "angles", "radius"):
+        layout[name] = take(pixels, "B")
+    if flags & HAS_FIBONACCI:
+        for name in ("physicalToFibonacci", "fibonacciToPhysical"):
+            layout[name] = take(pixels, index_format(pixels))
+    if flags & HAS_NEIGHBORS:
+        values = take(pixels * per_pixel, "H")
+        layout["neighbors"] = [[j for j in values[i * per_pixel:(i + 1) * per_pixel] if j != NO_NEIGHBOR] for i in range(pixels)]
+    if flags & HAS_RINGS:
+        values = take(2 * ring_count, "H")
+        layout["rings"] = [tuple(values[2 * r:2 * r + 2]) for r in range(ring_count)]
+    if offset != len(data):
+        raise LayoutError("file size does not match header")
+    check_layout(layout)
+    return layout
+
+
+def read_csv(path, fibonacci, scale_coordinates=True):
+    with open(path, newline="") as f:
+        rows = [{k.strip().lower(): (v or "").strip() for k, v in row.items()} for row in csv.DictReader(f)]
+    if not rows:
+        raise LayoutError("no pixels in {}".format(path))
+    for column in ("x", "y"):
+        if column not in rows[0]:
+            raise LayoutError("missing required column '{}'".format(column))
+    xs = [float(row["x"]) for row in rows]
+    ys = [float(row["y"]) for row in rows]
+
+    if scale_coordinates:
+        # translate so left side and bottom align with the axes, then scale into [0.0 .. 256.0]
+        shift_x, shift_y = min(xs), min(ys)
+        extent = max(max(xs) - shift_x, max(ys) - shift_y) or 1.0
+        scale = 256.0 / extent
+        layout = {
+            # subtract 0.5 to avoid bias
+            "coordsX": [min(255, max(0, int((x - shift_x) * scale - 0.5))) for x in xs],
+            "coordsY": [min(255, max(0, int((y - shift_y) * scale - 0.5))) for y in ys],
+        }
+    else:
+        layout = {"coordsX": [int(x) for x in xs], "coordsY": [int(y) for y in ys]}
+
+    center_x = (min(xs) + max(xs)) / 2
+    center_y = (min(ys) + max(ys)) / 2
+    distances = [math.hypot(x - center_x, y - center_y) for x, y in zip(xs, ys)]
+    max_distance = max(distances) or 1.0
+    if rows[0].get("angle", "") != "":
+        layout["angles"] = [int(row["angle"]) for row in rows]
+    else:
+        layout["angles"] = [int(round(math.atan2(y - center_y, x - center_x) * 256 / (2 * math.pi))) % 256 for x, y in zip(xs, ys)]
+    if rows[0].get("radius", "") != "":
+        layout["radius"] = [int(row["radius"]) for row in rows]
+    else:
+        layout["radius"] = [int(round(d / max_distance * 255)) for d in distances]
+
+    if rows[0].get("fibonacci", "") != "":
+        order = [int(row["fibonacci"]) for row in rows]
+    elif fibonacci:
+        by_spiral = sorted(range(len(rows)), key=lambda i: (distances[i], layout["angles"][i]))
+        order = [0] * len(rows)
+        for n, physical in enumerate(by_spiral):
+            order[physical] = n
+    else:
+        order = None
+    if order is not None:
+        check_permutation("fibonacci", order, len(rows))
+        layout["physicalToFibonacci"] = order
+        layout["fibonacciToPhysical"] = [0] * len(rows)
+        for physical, n in enumerate(order):
+            layout["fibonacciToPhysical"][n] = physical
+
+    if "neighbors" in rows[0]:
+        layout["neighbors"] = [[int(j) for j in row["neighbors"].split()] for row in rows]
+    if "ring" in rows[0]:
+        ring_of = [int(row["ring"]) for row in rows]
+        layout["rings"] = []
+        for i, ring in enumerate(ring_of):
+            if ring == len(layout["rings"]):
+                layout["rings"].append([i, i])
+            elif ring == len(layout["rings"]) - 1:
+                layout["rings"][-1][1] = i
+            else:
+                raise LayoutError("pixel {}: rings must be numbered from 0, with each ring's pixels consecutive".format(i))
+    return layout
+
+
+def summary(layout):
+    parts = ["{} pixels".format(len(layout["coordsX"]))]
+    if layout.get("physicalToFibonacci") is not None:
+        parts.append("fibonacci order")
+    if layout.get("neighbors") is not None:
+        parts.append("up to {} neighbors per pixel".format(max(len(a) for a in layout["neighbors"])))
+    if layout.get("rings") is not None:
+        parts.append("{} rings".format(len(layout["rings"])))
+    return ", ".join(parts)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command")
+    build = commands.add_parser("build", help="convert a CSV layout to a layout file")
+    build.add_argument("csv")
+    build.add_argument("-o", "--output", default="layout.bin")
+    build.add_argument("--fibonacci", action="store_true", help="derive the spiral order when there is no fibonacci column")
+    build.add_argument("--no-scale", action="store_true", help="x and y are already 0 .. 255 (e.g., from dump)")
+    check = commands.add_parser("check", help="validate a layout file")
+    check.add_argument("file")
+    check.add_argument("--pixels", type=int, help="NUM_PIXELS of the firmware that will load it")
+    dump = commands.add_parser("dump", help="print a layout file as CSV")
+    dump.add_argument("file")
+    args = parser.parse_args()
+
+    try:
+        if args.command == "build":
+            layout = read_csv(args.csv, args.fibonacci, not args.no_scale)
+            data = encode(layout)
+            with open(args.output, "wb") as f:
+                f.write(data)
+            print("{}: {} bytes, {}".format(args.output, len(data), summary(layout)))
+        elif args.command == "check":
+            with open(args.file, "rb") as f:
+                layout = decode(f.read())
+            if args.pixels is not None and args.pixels != len(layout["coordsX"]):
+                raise LayoutError("{} pixels, but NUM_PIXELS is {}".format(len(layout["coordsX"]), args.pixels))
+            print("{}: OK, {}".format(args.file, summary(layout)))
+        elif args.command == "dump":
+            with open(args.file, "rb") as f:
+                layout = decode(f.read())
+            ring_of = {}
+            for ring, (first, last) in enumerate(layout.get("rings") or []):
+                for i in range(first, last + 1):
+                    ring_of[i] = ring
+            writer = csv.writer(sys.stdout)
+            columns = ["x", "y", "angle", "radius"]
+            columns += ["fibonacci"] if layout.get("physicalToFibonacci") is not None else []
+            columns += ["neighbors"] if layout.get("neighbors") is not None else []
+            columns += ["ring"] if layout.get("rings") is not None else []
+            writer.writerow(columns)
+            for i in range(len(layout["coordsX"])):
+                row = [layout["coordsX"][i], layout["coordsY"][i], layout["angles"][i], layout["radius"][i]]
+                if layout.get("physicalToFibonacci") is not None:
+                    row.append(layout["physicalToFibonacci"][i])
+                if layout.get("neighbors") is not None:
+                    row.append(" ".join(str(j) for j in layout["neighbors"][i]))
+                if layout.get("rings") is not None:
+                    row.append(ring_of[i])
+                writer.writerow(row)
+        else:
+            parser.print_help()
+            return 2
+    except (LayoutError, ValueError, KeyError) as e:
+        sys.exit("error: {}".format(e))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# Generate the coordinate map for a Fibonacci (Vogel spiral) panel, in the
+# format used by esp8266-fastled-webserver/Map.cpp.
+#
+# The derivation is the one documented at the top of Map.cpp:
+#   r = sqrt(n), theta = n * GOLDEN_ANGLE, for spiral index n
+# then translate / scale the cartesian coordinates into [0 .. 255].
+#
+# The physical wiring cannot be derived from the model, so it is an input:
+# a file listing, in physical (wiring) order, the spiral index of each pixel
+# (i.e., the contents of physicalToFibonacci[]).  Without it, the pixels are
+# assumed to be wired in spiral order.
+#
+# A helper for adding a new panel only: the build does not run it, and the
+# tables already in Map.cpp are maintained by hand.  Its output for an existing
+# board is close to, but not the same as, that board's tables; check the result
+# on the panel itself before committing it.
+#
+# Derived indices (e.g., pixels sorted by angle) are built by the firmware at
+# boot, from whichever tables a product has; see Map.cpp.
+#
+# Example:
+#   python3 scripts/vogel-map.py --pixels 256 --wiring wiring256.txt --product PRODUCT_FIBONACCI256
+
+import argparse
+import math
+import re
+import sys
+
+GOLDEN_ANGLE = math.pi * (3 - math.sqrt(5))
+
+
+def read_wiring(path, pixels):
+    with open(path) as f:
+        wiring = [int(v) for v in re.findall(r"\d+", f.read())]
+    if sorted(wiring) != list(range(pixels)):
+        sys.exit("wiring must list each spiral index 0 .. {} exactly once".format(pixels - 1))
+    return wiring
+
+
+def vogel_map(pixels, wiring, radius_mode):
+    xs = [math.sqrt(n) * math.cos(n * GOLDEN_ANGLE) for n in wiring]
+    ys = [math.sqrt(n) * math.sin(n * GOLDEN_ANGLE) for n in wiring]
+
+    # translate so left side and bottom align with the axes, then scale into [0.0 .. 256.0]
+    shift_x, shift_y = min(xs), min(ys)
+    xs = [x - shift_x for x in xs]
+    ys = [y - shift_y for y in ys]
+    scale = 256.0 / max(max(xs), max(ys))
+    # subtract 0.5 to avoid bias
+    coords_x = [min(255, max(0, int(x * scale - 0.5))) for x in xs]
+    coords_y = [min(255, max(0, int(y * scale - 0.5))) for y in ys]
+
+    angles = [int(round(n * GOLDEN_ANGLE * 256 / (2 * math.pi))) % 256 for n in wiring]
+    if radius_mode == "sqrt":
+        radius = [int(round(math.sqrt(n) / math.sqrt(pixels - 1) * 255)) for n in wiring]
+    else:
+        radius = [int(round(n * 255 / (pixels - 1))) for n in wiring]
+
+    fibonacci_to_physical = [0] * pixels
+    for physical, n in enumerate(wiring):
+        fibonacci_to_physical[n] = physical
+
+    return [
+        ("physicalToFibonacci", wiring),
+        ("fibonacciToPhysical", fibonacci_to_physical),
+        ("coordsX", coords_x),
+        ("coordsY", coords_y),
+        ("angles", angles),
+        ("radius", radius),
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--pixels", type=int, required=True, help="NUM_PIXELS")
+    parser.add_argument("--wiring", help="file with physicalToFibonacci[] (spiral index of each pixel, in wiring order)")
+    parser.add_argument("--radius", choices=["sqrt", "linear"], default="sqrt",
+                        help="radius[] proportional to sqrt(n) (true radius), or to n (as on the 32 .. 128 pixel products)")
+    parser.add_argument("--product", default="PRODUCT_NEW", help="product symbol for the generated #elif")
+    args = parser.parse_args()
+
+    if args.pixels < 2:
+        sys.exit("--pixels must be at least 2")
+    wiring = read_wiring(args.wiring, args.pixels) if args.wiring else list(range(args.pixels))
+
+    index_type = "uint16_t" if args.pixels > 256 else "uint8_t "
+    print("#elif defined({})".format(args.product))
+    for name, values in vogel_map(args.pixels, wiring, args.radius):
+        element_type = index_type if name.endswith("Fibonacci") or name.endswith("Physical") else "uint8_t "
+        declaration = "const {} {}_p[NUM_PIXELS] MAP_TABLE_PROGMEM".format(element_type, name)
+        print("  {:<66} {{ {} }};".format(declaration, ", ".join(str(v) for v in values)))
+    print("  const uint8_t (&radiusProxy_p)[NUM_PIXELS] = radius_p;")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+#pragma once
+
+// The parts of the Arduino core used by the code under test.  Flash is ordinary
+// memory on the host.
+
+#define PROGMEM
+#define PGM_P const char*
+
+#define pgm_read_byte(addr)  (*reinterpret_cast<const uint8_t*>(addr))
+#define pgm_read_word(addr)  (*reinterpret_cast<const uint16_t*>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t*>(addr))
+#define PSTR(s) (s)
+#define vsnprintf_P vsnprintf
+#define memcpy_P memcpy
+#define strcmp_P strcmp
+#define strlen_P strlen
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+template <typename T> inline T min(T a, T b) { return (a < b) ? a : b; }
+template <typename T> inline T max(T a, T b) { return (a > b) ? a : b; }
+
+typedef uint8_t byte;
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// Arduino's random(howbig); the sketch only uses it for entropy
+inline long random(long howbig) { return (long)(::random() % howbig); }
+
+// The clock seen by the code under test, which a test sets (or advances) itself
+inline uint32_t& hostMillis() { static uint32_t now = 0; return now; }
+inline uint32_t millis() { return hostMillis(); }
+
+// The microseconds within the current millisecond
+inline uint32_t& hostMicrosRemainder() { static uint32_t remainder = 0; return remainder; }
+inline uint32_t micros() { return hostMillis() * 1000 + hostMicrosRemainder(); }
+
+// For stand-ins that take the time the real thing would (e.g., a write to a socket)
+inline void hostAdvanceMicros(uint32_t micros) {
+  micros += hostMicrosRemainder();
+  hostMillis() += micros / 1000;
+  hostMicrosRemainder() = micros % 1000;
+}
+
+inline void delay(uint32_t ms) { hostMillis() += ms; }
+inline void yield() {}
@@ -0,0 +1,153 @@
+#pragma once
+
+// Included by common.h instead of the Arduino core, FastLED, the libraries and
+// config.h when HOST_UNIT_TEST is defined, so a test can build a source file
+// of the sketch with the host compiler.  A test defines the config.h options
+// its code depends on before including that source file.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+#if !defined(PARALLEL_PIXEL_KERNELS)
+  #define PARALLEL_PIXEL_KERNELS 0
+#endif
+#if !defined(NETWORK_TASK_CORE)
+  #define NETWORK_TASK_CORE 0
+#endif
+#if !defined(NUM_PIXELS)
+  #define NUM_PIXELS 256
+#endif
+#if !defined(IS_FIBONACCI)
+  #define IS_FIBONACCI 0
+#endif
+#if !defined(LOGICAL_RENDER_BUFFER)
+  #define LOGICAL_RENDER_BUFFER 0
+#endif
+#if !defined(SWAR_PIXEL_KERNELS)
+  #define SWAR_PIXEL_KERNELS 1
+#endif
+#if !defined(HAS_COORDINATE_MAP)
+  #define HAS_COORDINATE_MAP IS_FIBONACCI
+#endif
+#if !defined(ENABLE_NTP)
+  #define ENABLE_NTP 0
+#endif
+#if !defined(NTP_SERVER)
+  #define NTP_SERVER "pool.ntp.org"
+#endif
+#if !defined(ENABLE_DISCOVERY)
+  #define ENABLE_DISCOVERY 0
+#endif
+#if !defined(RENDER_TASK_ON_SEPARATE_CORE)
+  #define RENDER_TASK_ON_SEPARATE_CORE 0
+#endif
+#if !defined(EMBED_WEB_ASSETS)
+  #define EMBED_WEB_ASSETS 0
+#endif
+#if !defined(TRANSFER_CHUNK_BYTES)
+  #define TRANSFER_CHUNK_BYTES 1460
+#endif
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+#if !defined(LOG_LEVEL)
+  #define LOG_LEVEL LOG_LEVEL_NONE
+#endif
+#if !defined(LOG_BUFFER_SIZE)
+  #define LOG_BUFFER_SIZE 2048
+#endif
+
+#include "host_arduino.h"
+#include "host_network.h"
+#include "host_webserver.h"
+#include "host_fastled.h"
+#include "host_freertos.h"
+
+#include "../../esp8266-fastled-webserver/include/simplehacks/static_eval.h"
+#include "../../esp8266-fastled-webserver/include/simplehacks/array_size2.h"
+#include "../../esp8266-fastled-webserver/include/MapTable.hpp"
+#include "../../esp8266-fastled-webserver/include/ParameterSnapshot.hpp"
+#include "../../esp8266-fastled-webserver/include/NtpClock.hpp"
+#include "../../esp8266-fastled-webserver/include/Log.hpp"
+#include "../../esp8266-fastled-webserver/include/FSBrowser.hpp"
+#include "../../esp8266-fastled-webserver/include/AssetIndex.hpp"
+#include "../../esp8266-fastled-webserver/include/WebAssets.hpp"
+#include "../../esp8266-fastled-webserver/include/Transfers.hpp"
+
+// IR (commands.cpp)
+#define IR_REMOTES_FILE_PATH "/remotes.txt"
+#if defined(ENABLE_IR)
+  #include "host_ir.h"
+  extern IRrecv irReceiver;
+  void handleIrInput();
+  bool loadIrRemotes(const char* path = IR_REMOTES_FILE_PATH);
+#endif
+
+// The sketch's globals and render parameters (see common.h), defined by a test that uses them
+typedef struct {
+  uint8_t power;
+  uint8_t brightness;
+  uint8_t currentPatternIndex;
+  uint8_t showClock;
+  CRGB    solidColor;
+} RenderParameters;
+const RenderParameters& renderParameters();
+
+extern String nameString;
+extern ESP8266WebServer webServer;
+extern CRGBPalette16 gCurrentPalette;
+extern uint8_t cooling;
+extern uint8_t sparking;
+extern uint8_t speed;
+extern uint8_t currentPaletteIndex;
+extern uint8_t clockBackgroundFade;
+extern const CRGBPalette16 palettes[];
+extern CRGB leds[NUM_PIXELS];
+extern uint8_t saturationBpm;
+extern uint8_t saturationMin;
+extern uint8_t saturationMax;
+extern uint8_t brightDepthBpm;
+extern uint8_t brightDepthMin;
+extern uint8_t brightDepthMax;
+extern uint8_t brightThetaIncBpm;
+extern uint8_t brightThetaIncMin;
+extern uint8_t brightThetaIncMax;
+extern uint8_t msMultiplierBpm;
+extern uint8_t msMultiplierMin;
+extern uint8_t msMultiplierMax;
+extern uint8_t hueIncBpm;
+extern uint8_t hueIncMin;
+extern uint8_t hueIncMax;
+extern uint8_t sHueBpm;
+extern uint8_t sHueMin;
+extern uint8_t sHueMax;
+
+#if IS_FIBONACCI
+  #if NUM_PIXELS > 256
+    typedef uint16_t fibonacci_index_t;
+  #else
+    typedef uint8_t fibonacci_index_t;
+  #endif
+  extern MapTable<fibonacci_index_t> physicalToFibonacci;
+  extern MapTable<fibonacci_index_t> fibonacciToPhysical;
+#endif
+
+#include "../../esp8266-fastled-webserver/include/ForkJoin.hpp"
+#include "../../esp8266-fastled-webserver/include/PixelOrder.hpp"
+#include "../../esp8266-fastled-webserver/include/SwarKernels.hpp"
+#include "../../esp8266-fastled-webserver/include/WaveKernels.hpp"
+
+#if HAS_COORDINATE_MAP
+  extern MapTable<uint8_t> coordsX;
+  extern MapTable<uint8_t> coordsY;
+  extern MapTable<uint8_t> angles;
+  extern MapTable<uint8_t> radiusProxy;
+  void antialiasPixelAR(uint8_t angle, uint8_t dAngle, uint8_t startRadius, uint8_t endRadius, CRGB color, CRGB leds[] = leds);
+  void releaseMapBuffers();
+#endif
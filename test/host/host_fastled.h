@@ -0,0 +1,506 @@
+#pragma once
+
+// The parts of FastLED 3.4.0 used by the code under test, transcribed from its
+// portable C paths (lib8tion, pixeltypes.h, colorutils), with FastLED's defaults
+// FASTLED_SCALE8_FIXED and FASTLED_BLEND_FIXED.  Tests compare the sketch's
+// kernels against these, so keep them bit-for-bit identical to the library.
+
+typedef uint8_t fract8;
+
+inline uint8_t scale8(uint8_t i, fract8 scale) {
+  return (((uint16_t)i) * (1 + (uint16_t)scale)) >> 8;
+}
+
+inline uint8_t scale8_video(uint8_t i, fract8 scale) {
+  uint8_t j = (((int)i * (int)scale) >> 8) + ((i && scale) ? 1 : 0);
+  return j;
+}
+
+inline uint16_t scale16(uint16_t i, uint16_t scale) {
+  return ((uint32_t)(i) * (1 + (uint32_t)(scale))) / 65536;
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+  unsigned int t = i + j;
+  if (t > 255) t = 255;
+  return t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+  int t = i - j;
+  if (t < 0) t = 0;
+  return t;
+}
+
+inline uint8_t sub8(uint8_t i, uint8_t j) {
+  int t = i - j;
+  return t;
+}
+
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+  uint16_t partial;
+  uint8_t result;
+  partial = (a << 8) | b; // a * 256 + b
+  partial += (b * amountOfB);
+  partial -= (a * amountOfB);
+  result = partial >> 8;
+  return result;
+}
+
+// random8() and friends, with FastLED's generator and seed
+inline uint16_t& hostRand16seed() { static uint16_t seed = 1337; return seed; }
+#define rand16seed (hostRand16seed())
+
+inline uint8_t random8() {
+  rand16seed = (rand16seed << 11) + (rand16seed << 2) + rand16seed + 13849;
+  return (uint8_t)(((uint8_t)(rand16seed & 0xFF)) + ((uint8_t)(rand16seed >> 8)));
+}
+inline uint16_t random16() {
+  rand16seed = (rand16seed << 11) + (rand16seed << 2) + rand16seed + 13849;
+  return rand16seed;
+}
+inline uint8_t random8(uint8_t lim) {
+  uint8_t r = random8();
+  r = (r * lim) >> 8;
+  return r;
+}
+inline uint8_t random8(uint8_t min, uint8_t lim) {
+  uint8_t delta = lim - min;
+  uint8_t r = random8(delta) + min;
+  return r;
+}
+inline uint16_t random16(uint16_t lim) {
+  uint16_t r = random16();
+  uint32_t p = (uint32_t)lim * (uint32_t)r;
+  r = p >> 16;
+  return r;
+}
+inline void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+inline void random16_add_entropy(uint16_t entropy) { rand16seed += entropy; }
+
+inline int16_t sin16(uint16_t theta) {
+  static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+  uint16_t offset = (theta & 0x3FFF) >> 3; // 0..2047
+  if (theta & 0x4000) offset = 2047 - offset;
+  uint8_t section = offset / 256; // 0..7
+  uint16_t b = base[section];
+  uint8_t m = slope[section];
+  uint8_t secoffset8 = (uint8_t)(offset) / 2;
+  uint16_t mx = m * secoffset8;
+  int16_t y = mx + b;
+  if (theta & 0x8000) y = -y;
+  return y;
+}
+inline int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+
+inline uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+  uint8_t offset = theta;
+  if (theta & 0x40) {
+    offset = (uint8_t)255 - offset;
+  }
+  offset &= 0x3F; // 0..63
+  uint8_t secoffset = offset & 0x0F; // 0..15
+  if (theta & 0x40) ++secoffset;
+  uint8_t section = offset >> 4; // 0..3
+  uint8_t s2 = section * 2;
+  const uint8_t* p = b_m16_interleave;
+  p += s2;
+  uint8_t b = *p;
+  ++p;
+  uint8_t m16 = *p;
+  uint8_t mx = (m16 * secoffset) >> 4;
+  int8_t y = mx + b;
+  if (theta & 0x80) y = -y;
+  y += 128;
+  return y;
+}
+inline uint8_t cos8(uint8_t theta) { return sin8(theta + 64); }
+
+// beat*() read the clock through GET_MILLIS, as in FastLED
+#define GET_MILLIS millis
+typedef uint16_t accum88;
+
+inline uint16_t beat88(accum88 beats_per_minute_88, uint32_t timebase = 0) {
+  return (((GET_MILLIS()) - timebase) * beats_per_minute_88 * 280) >> 16;
+}
+inline uint16_t beat16(accum88 beats_per_minute, uint32_t timebase = 0) {
+  if (beats_per_minute < 256) beats_per_minute <<= 8;
+  return beat88(beats_per_minute, timebase);
+}
+inline uint8_t beat8(accum88 beats_per_minute, uint32_t timebase = 0) {
+  return beat16(beats_per_minute, timebase) >> 8;
+}
+inline uint16_t beatsin88(accum88 beats_per_minute_88, uint16_t lowest = 0, uint16_t highest = 65535,
+                          uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beat = beat88(beats_per_minute_88, timebase);
+  uint16_t beatsin = (sin16(beat + phase_offset) + 32768);
+  uint16_t rangewidth = highest - lowest;
+  uint16_t scaledbeat = scale16(beatsin, rangewidth);
+  uint16_t result = lowest + scaledbeat;
+  return result;
+}
+inline uint16_t beatsin16(accum88 beats_per_minute, uint16_t lowest = 0, uint16_t highest = 65535,
+                          uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beat = beat16(beats_per_minute, timebase);
+  uint16_t beatsin = (sin16(beat + phase_offset) + 32768);
+  uint16_t rangewidth = highest - lowest;
+  uint16_t scaledbeat = scale16(beatsin, rangewidth);
+  uint16_t result = lowest + scaledbeat;
+  return result;
+}
+inline uint8_t beatsin8(accum88 beats_per_minute, uint8_t lowest = 0, uint8_t highest = 255,
+                        uint32_t timebase = 0, uint8_t phase_offset = 0) {
+  uint8_t beat = beat8(beats_per_minute, timebase);
+  uint8_t beatsin = sin8(beat + phase_offset);
+  uint8_t rangewidth = highest - lowest;
+  uint8_t scaledbeat = scale8(beatsin, rangewidth);
+  uint8_t result = lowest + scaledbeat;
+  return result;
+}
+
+// EVERY_N_MILLIS(), on the GET_MILLIS clock
+class CEveryNMillis {
+public:
+  CEveryNMillis(uint32_t period) : mPeriod(period) { reset(); }
+  void reset() { mPrevTrigger = GET_MILLIS(); }
+  bool ready() {
+    bool isReady = (GET_MILLIS() - mPrevTrigger) >= mPeriod;
+    if (isReady) {
+      reset();
+    }
+    return isReady;
+  }
+  operator bool() { return ready(); }
+private:
+  uint32_t mPrevTrigger;
+  uint32_t mPeriod;
+};
+#define CONCAT_HELPER(x, y) x##y
+#define CONCAT_MACRO(x, y) CONCAT_HELPER(x, y)
+#define EVERY_N_MILLIS_I(NAME, N) static CEveryNMillis NAME(N); if (NAME)
+#define EVERY_N_MILLIS(N) EVERY_N_MILLIS_I(CONCAT_MACRO(PER, __COUNTER__), N)
+
+struct CRGB {
+  union {
+    struct {
+      union { uint8_t r; uint8_t red; };
+      union { uint8_t g; uint8_t green; };
+      union { uint8_t b; uint8_t blue; };
+    };
+    uint8_t raw[3];
+  };
+
+  enum HTMLColorCode : uint32_t {
+    Aqua = 0x00FFFF, Black = 0x000000, Blue = 0x0000FF, Gray = 0x808080, Green = 0x008000,
+    Red = 0xFF0000, White = 0xFFFFFF, FairyLight = 0xFFE42D,
+    // the solid colors of the IR remotes (commands.cpp)
+    CornflowerBlue = 0x6495ED, Goldenrod = 0xDAA520, Indigo = 0x4B0082, LightBlue = 0xADD8E6,
+    LightPink = 0xFFB6C1, Lime = 0x00FF00, Magenta = 0xFF00FF, Navy = 0x000080, Orange = 0xFFA500,
+    OrangeRed = 0xFF4500, Pink = 0xFFC0CB, Purple = 0x800080, RoyalBlue = 0x4169E1, Teal = 0x008080,
+    Yellow = 0xFFFF00,
+  };
+
+  CRGB() {}
+  constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  constexpr CRGB(uint32_t colorcode)
+    : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b((colorcode >> 0) & 0xFF) {}
+
+  CRGB& operator+=(const CRGB& rhs) {
+    r = qadd8(r, rhs.r);
+    g = qadd8(g, rhs.g);
+    b = qadd8(b, rhs.b);
+    return *this;
+  }
+
+  CRGB& operator|=(const CRGB& rhs) {
+    if (rhs.r > r) r = rhs.r;
+    if (rhs.g > g) g = rhs.g;
+    if (rhs.b > b) b = rhs.b;
+    return *this;
+  }
+
+  CRGB& nscale8(uint8_t scaledown) {
+    r = scale8(r, scaledown);
+    g = scale8(g, scaledown);
+    b = scale8(b, scaledown);
+    return *this;
+  }
+
+  CRGB& nscale8_video(uint8_t scale) {
+    uint8_t nonzeroscale = (scale != 0) ? 1 : 0;
+    r = (r == 0) ? 0 : (((int)r * (int)(scale)) >> 8) + nonzeroscale;
+    g = (g == 0) ? 0 : (((int)g * (int)(scale)) >> 8) + nonzeroscale;
+    b = (b == 0) ? 0 : (((int)b * (int)(scale)) >> 8) + nonzeroscale;
+    return *this;
+  }
+
+  CRGB& fadeToBlackBy(uint8_t fadefactor) {
+    nscale8(255 - fadefactor);
+    return *this;
+  }
+
+  operator bool() const { return r || g || b; }
+
+  uint8_t getAverageLight() const {
+    const uint8_t eightyfive = 85;
+    uint8_t avg = scale8(r, eightyfive) + scale8(g, eightyfive) + scale8(b, eightyfive);
+    return avg;
+  }
+};
+
+inline CRGB operator+(const CRGB& p1, const CRGB& p2) {
+  return CRGB(qadd8(p1.r, p2.r), qadd8(p1.g, p2.g), qadd8(p1.b, p2.b));
+}
+
+inline bool operator==(const CRGB& lhs, const CRGB& rhs) {
+  return (lhs.r == rhs.r) && (lhs.g == rhs.g) && (lhs.b == rhs.b);
+}
+
+inline bool operator!=(const CRGB& lhs, const CRGB& rhs) {
+  return !(lhs == rhs);
+}
+
+inline void fill_solid(CRGB* leds, int numToFill, const CRGB& color) {
+  for (int i = 0; i < numToFill; i++) {
+    leds[i] = color;
+  }
+}
+
+inline void nscale8(CRGB* leds, uint16_t num_leds, uint8_t scale) {
+  for (uint16_t i = 0; i < num_leds; i++) {
+    leds[i].nscale8(scale);
+  }
+}
+
+inline void fadeToBlackBy(CRGB* leds, uint16_t num_leds, uint8_t fadeBy) {
+  nscale8(leds, num_leds, 255 - fadeBy);
+}
+
+inline CRGB& nblend(CRGB& existing, const CRGB& overlay, fract8 amountOfOverlay) {
+  if (amountOfOverlay == 0) {
+    return existing;
+  }
+  if (amountOfOverlay == 255) {
+    existing = overlay;
+    return existing;
+  }
+  existing.red   = blend8(existing.red,   overlay.red,   amountOfOverlay);
+  existing.green = blend8(existing.green, overlay.green, amountOfOverlay);
+  existing.blue  = blend8(existing.blue,  overlay.blue,  amountOfOverlay);
+  return existing;
+}
+
+inline void nblend(CRGB* existing, const CRGB* overlay, uint16_t count, fract8 amountOfOverlay) {
+  for (uint16_t i = 0; i < count; i++) {
+    nblend(existing[i], overlay[i], amountOfOverlay);
+  }
+}
+
+inline CRGB blend(const CRGB& p1, const CRGB& p2, fract8 amountOfP2) {
+  CRGB nu(p1);
+  nblend(nu, p2, amountOfP2);
+  return nu;
+}
+
+struct CHSV {
+  uint8_t hue;
+  uint8_t sat;
+  uint8_t val;
+  CHSV(uint8_t ih, uint8_t is, uint8_t iv) : hue(ih), sat(is), val(iv) {}
+};
+
+// hsv2rgb.cpp, with the default yellow boost (Y1) and no green scaling
+inline void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+  uint8_t hue = hsv.hue;
+  uint8_t sat = hsv.sat;
+  uint8_t val = hsv.val;
+
+  uint8_t offset = hue & 0x1F; // 0..31
+  uint8_t offset8 = offset << 3;
+  uint8_t third = scale8(offset8, (256 / 3)); // max = 85
+
+  uint8_t r, g, b;
+  if (!(hue & 0x80)) {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) {
+        r = 255 - third; g = third; b = 0;                       // R -> O
+      } else {
+        r = 171; g = 85 + third; b = 0;                          // O -> Y
+      }
+    } else {
+      if (!(hue & 0x20)) {
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));   // Y -> G
+        r = 171 - twothirds; g = 170 + third; b = 0;
+      } else {
+        r = 0; g = 255 - third; b = third;                       // G -> A
+      }
+    }
+  } else {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) {
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));   // A -> B
+        r = 0; g = 171 - twothirds; b = 85 + twothirds;
+      } else {
+        r = third; g = 0; b = 255 - third;                       // B -> P
+      }
+    } else {
+      if (!(hue & 0x20)) {
+        r = 85 + third; g = 0; b = 171 - third;                  // P -> K
+      } else {
+        r = 170 + third; g = 0; b = 85 - third;                  // K -> R
+      }
+    }
+  }
+
+  if (sat != 255) {
+    if (sat == 0) {
+      r = 255; b = 255; g = 255;
+    } else {
+      if (r) r = scale8(r, sat);
+      if (g) g = scale8(g, sat);
+      if (b) b = scale8(b, sat);
+      uint8_t desat = 255 - sat;
+      desat = scale8(desat, desat);
+      uint8_t brightness_floor = desat;
+      r += brightness_floor;
+      g += brightness_floor;
+      b += brightness_floor;
+    }
+  }
+
+  if (val != 255) {
+    val = scale8_video(val, val);
+    if (val == 0) {
+      r = 0; g = 0; b = 0;
+    } else {
+      if (r) r = scale8(r, val);
+      if (g) g = scale8(g, val);
+      if (b) b = scale8(b, val);
+    }
+  }
+
+  rgb.r = r;
+  rgb.g = g;
+  rgb.b = b;
+}
+
+#define FL_PROGMEM PROGMEM
+#define FL_ALIGN_PROGMEM __attribute__((aligned(4)))
+
+typedef enum { NOBLEND = 0, LINEARBLEND = 1 } TBlendType;
+typedef const uint32_t TProgmemRGBPalette16[16];
+
+struct CRGBPalette16 {
+  CRGB entries[16];
+
+  CRGBPalette16() {}
+  CRGBPalette16(const CRGB& c00, const CRGB& c01, const CRGB& c02, const CRGB& c03,
+                const CRGB& c04, const CRGB& c05, const CRGB& c06, const CRGB& c07,
+                const CRGB& c08, const CRGB& c09, const CRGB& c10, const CRGB& c11,
+                const CRGB& c12, const CRGB& c13, const CRGB& c14, const CRGB& c15) {
+    entries[0] = c00; entries[1] = c01; entries[2] = c02; entries[3] = c03;
+    entries[4] = c04; entries[5] = c05; entries[6] = c06; entries[7] = c07;
+    entries[8] = c08; entries[9] = c09; entries[10] = c10; entries[11] = c11;
+    entries[12] = c12; entries[13] = c13; entries[14] = c14; entries[15] = c15;
+  }
+  CRGBPalette16(TProgmemRGBPalette16& rhs) {
+    for (uint8_t i = 0; i < 16; i++) {
+      entries[i] = CRGB(pgm_read_dword(rhs + i));
+    }
+  }
+
+  CRGB& operator[](uint8_t x) { return entries[x]; }
+  const CRGB& operator[](uint8_t x) const { return entries[x]; }
+};
+
+inline CRGB ColorFromPalette(const CRGBPalette16& pal, uint8_t index, uint8_t brightness = 255,
+                             TBlendType blendType = LINEARBLEND) {
+  uint8_t hi4 = index >> 4;
+  uint8_t lo4 = index & 0x0F;
+  const CRGB* entry = &(pal[0]) + hi4;
+  uint8_t blend = lo4 && (blendType != NOBLEND);
+
+  uint8_t red1   = entry->red;
+  uint8_t green1 = entry->green;
+  uint8_t blue1  = entry->blue;
+
+  if (blend) {
+    if (hi4 == 15) {
+      entry = &(pal[0]);
+    } else {
+      ++entry;
+    }
+    uint8_t f2 = lo4 << 4;
+    uint8_t f1 = 255 - f2;
+
+    uint8_t red2 = entry->red;
+    red1 = scale8(red1, f1);
+    red2 = scale8(red2, f2);
+    red1 += red2;
+
+    uint8_t green2 = entry->green;
+    green1 = scale8(green1, f1);
+    green2 = scale8(green2, f2);
+    green1 += green2;
+
+    uint8_t blue2 = entry->blue;
+    blue1 = scale8(blue1, f1);
+    blue2 = scale8(blue2, f2);
+    blue1 += blue2;
+  }
+
+  if (brightness != 255) {
+    if (brightness) {
+      ++brightness; // adjust for rounding
+      if (red1)   red1   = scale8(red1,   brightness);
+      if (green1) green1 = scale8(green1, brightness);
+      if (blue1)  blue1  = scale8(blue1,  brightness);
+    } else {
+      red1 = 0;
+      green1 = 0;
+      blue1 = 0;
+    }
+  }
+  return CRGB(red1, green1, blue1);
+}
+
+// FastLED's predefined palettes (colorpalettes.cpp), with the color names as values
+const TProgmemRGBPalette16 CloudColors_p = {
+  0x0000FF, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B,
+  0x0000FF, 0x00008B, 0x87CEEB, 0x87CEEB, 0xADD8E6, 0xFFFFFF, 0xADD8E6, 0x87CEEB };
+const TProgmemRGBPalette16 LavaColors_p = {
+  0x000000, 0x800000, 0x000000, 0x800000, 0x8B0000, 0x8B0000, 0x800000, 0x8B0000,
+  0x8B0000, 0x8B0000, 0xFF0000, 0xFFA500, 0xFFFFFF, 0xFFA500, 0xFF0000, 0x8B0000 };
+const TProgmemRGBPalette16 OceanColors_p = {
+  0x191970, 0x00008B, 0x191970, 0x000080, 0x00008B, 0x0000CD, 0x2E8B57, 0x008080,
+  0x5F9EA0, 0x0000FF, 0x008B8B, 0x6495ED, 0x7FFFD4, 0x2E8B57, 0x00FFFF, 0x87CEFA };
+const TProgmemRGBPalette16 ForestColors_p = {
+  0x006400, 0x006400, 0x556B2F, 0x006400, 0x008000, 0x228B22, 0x6B8E23, 0x008000,
+  0x2E8B57, 0x66CDAA, 0x32CD32, 0x9ACD32, 0x90EE90, 0x7CFC00, 0x66CDAA, 0x228B22 };
+const TProgmemRGBPalette16 RainbowColors_p = {
+  0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00, 0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+  0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5, 0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B };
+const TProgmemRGBPalette16 PartyColors_p = {
+  0x5500AB, 0x84007C, 0xB5004B, 0xE5001B, 0xE81700, 0xB84700, 0xAB7700, 0xABAB00,
+  0xAB5500, 0xDD2200, 0xF2000E, 0xC2003E, 0x8F0071, 0x5F00A1, 0x2F00D0, 0x0007F9 };
+const TProgmemRGBPalette16 HeatColors_p = {
+  0x000000, 0x330000, 0x660000, 0x990000, 0xCC0000, 0xFF0000, 0xFF3300, 0xFF6600,
+  0xFF9900, 0xFFCC00, 0xFFFF00, 0xFFFF33, 0xFFFF66, 0xFFFF99, 0xFFFFCC, 0xFFFFFF };
+
+// The output: show() takes the time writing the pixels out would, which a test sets
+struct HostFastLED {
+  uint32_t showMicros = 0;
+  void show() { hostAdvanceMicros(showMicros); }
+};
+static HostFastLED FastLED;
+
+// ChannelLayout.hpp's output, as a single channel
+static const uint8_t outputCount = 1;
+inline uint32_t showAllChannels(const CRGB*, uint32_t (&outputMicros)[outputCount]) {
+  const uint32_t start = micros();
+  FastLED.show();
+  outputMicros[0] = micros() - start;
+  return outputMicros[0];
+}
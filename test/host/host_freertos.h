@@ -0,0 +1,71 @@
+#pragma once
+
+// The FreeRTOS task and notification calls used by the code under test,
+// with each task a std::thread.
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+
+struct HostTask {
+  std::mutex mutex;
+  std::condition_variable notified;
+  uint32_t notifications = 0;
+};
+typedef HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+inline TaskHandle_t& hostCurrentTask() {
+  static thread_local TaskHandle_t current = nullptr;
+  return current;
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+  TaskHandle_t& current = hostCurrentTask();
+  if (current == nullptr) {
+    current = new HostTask(); // e.g., the test's main thread
+  }
+  return current;
+}
+
+// The task runs until the process exits; core and priority are ignored.
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char*, uint32_t, void* parameter,
+                                          UBaseType_t, TaskHandle_t* created, BaseType_t) {
+  TaskHandle_t task = new HostTask();
+  if (created != nullptr) {
+    *created = task;
+  }
+  std::thread([=]() {
+    hostCurrentTask() = task;
+    function(parameter);
+  }).detach();
+  return pdPASS;
+}
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> lock(task->mutex);
+    task->notifications++;
+  }
+  task->notified.notify_one();
+  return pdPASS;
+}
+
+// Only waiting forever is supported
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t) {
+  HostTask* task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->mutex);
+  task->notified.wait(lock, [task]() { return task->notifications != 0; });
+  const uint32_t count = task->notifications;
+  task->notifications = clearOnExit ? 0 : (count - 1);
+  return count;
+}
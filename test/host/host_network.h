@@ -0,0 +1,130 @@
+#pragma once
+
+// The parts of the ESP8266 core and its network libraries used by the code under
+// test.  WiFi is connected unless a test says otherwise, and Serial keeps what
+// is written to it.  An HTTPS request is answered by hostHttpsPost(), which a test
+// that sends one defines, standing in for the server and for the time BearSSL takes.
+
+#include <string>
+
+class String {
+public:
+  String() {}
+  String(const char* text) : _text(text ? text : "") {}
+  String(const std::string& text) : _text(text) {}
+  String(char c) : _text(1, c) {}
+  String(unsigned char value) : _text(std::to_string(value)) {}
+  String(int value) : _text(std::to_string(value)) {}
+  String(unsigned int value) : _text(std::to_string(value)) {}
+  String(long value) : _text(std::to_string(value)) {}
+  String(unsigned long value) : _text(std::to_string(value)) {}
+  String(double value, unsigned char decimals = 2) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    _text = text;
+  }
+
+  const char* c_str() const { return _text.c_str(); }
+  unsigned int length() const { return _text.length(); }
+  bool reserve(unsigned int size) { _text.reserve(size); return true; }
+  char operator[](unsigned int index) const { return _text[index]; }
+
+  String& operator+=(const String& other) { _text += other._text; return *this; }
+  String& operator+=(const char* other) { _text += other; return *this; }
+  String& operator+=(char c) { _text += c; return *this; }
+  bool concat(const char* text, unsigned int length) { _text.append(text, length); return true; }
+
+  friend String operator+(const String& a, const String& b) { return String(a._text + b._text); }
+  friend String operator+(const String& a, const char* b) { return String(a._text + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b._text); }
+  bool operator==(const String& other) const { return _text == other._text; }
+  bool operator==(const char* other) const { return _text == other; }
+  bool operator!=(const String& other) const { return _text != other._text; }
+  bool operator!=(const char* other) const { return _text != other; }
+  bool operator<(const String& other) const { return _text < other._text; }
+
+  int indexOf(const char* text) const { const size_t at = _text.find(text); return (at == std::string::npos) ? -1 : (int)at; }
+  int indexOf(char c) const { const size_t at = _text.find(c); return (at == std::string::npos) ? -1 : (int)at; }
+  bool startsWith(const String& prefix) const { return _text.compare(0, prefix._text.size(), prefix._text) == 0; }
+  bool endsWith(const String& suffix) const {
+    return (_text.size() >= suffix._text.size()) && (_text.compare(_text.size() - suffix._text.size(), suffix._text.size(), suffix._text) == 0);
+  }
+  String substring(unsigned int from) const { return String(_text.substr(min<size_t>(from, _text.size()))); }
+  String substring(unsigned int from, unsigned int to) const { return String(_text.substr(from, to - from)); }
+  long toInt() const { return strtol(_text.c_str(), nullptr, 10); }
+  void remove(unsigned int index) { _text.erase(min<size_t>(index, _text.size())); }
+  void trim() {
+    const size_t first = _text.find_first_not_of(" \t\r\n");
+    _text = (first == std::string::npos) ? std::string() : _text.substr(first, _text.find_last_not_of(" \t\r\n") - first + 1);
+  }
+
+private:
+  std::string _text;
+};
+
+// The UART: takes up to its FIFO's free space without waiting, which a test sets
+struct HostSerial {
+  size_t fifoFree = 128;
+  std::string written;
+  int availableForWrite() const { return (int)fifoFree; }
+  size_t write(const char* bytes, size_t count) {
+    count = min(count, fifoFree);
+    written.append(bytes, count);
+    fifoFree -= count;
+    return count;
+  }
+};
+static HostSerial Serial;
+
+class IPAddress {
+public:
+  IPAddress(uint32_t address = 0) : _address(address) {}
+  String toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", _address & 0xFF, (_address >> 8) & 0xFF, (_address >> 16) & 0xFF, _address >> 24);
+    return String(text);
+  }
+private:
+  uint32_t _address;
+};
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_NONE_SLEEP = 0, WIFI_LIGHT_SLEEP = 1, WIFI_MODEM_SLEEP = 2 } WiFiSleepType_t;
+
+struct HostWiFi {
+  bool connected = true;
+  WiFiSleepType_t sleepMode = WIFI_NONE_SLEEP;
+  bool setSleepMode(WiFiSleepType_t mode) { sleepMode = mode; return true; }
+  wl_status_t status() const { return connected ? WL_CONNECTED : WL_DISCONNECTED; }
+  IPAddress localIP() const { return IPAddress(0x0A01A8C0); } // 192.168.1.10
+  String macAddress() const { return String("5C:CF:7F:00:00:01"); }
+};
+static HostWiFi WiFi;
+
+// Defined by a test that sends HTTPS requests: blocks as the real request would
+// (advancing hostMillis()), and returns the HTTP status, or a negative error
+int hostHttpsPost(const String& url, const String& body, uint32_t timeoutMillis);
+
+namespace BearSSL {
+  class WiFiClientSecure {
+  public:
+    void setInsecure() {}
+    void setTimeout(unsigned long timeoutMillis) { _timeoutMillis = timeoutMillis; }
+    unsigned long timeout() const { return _timeoutMillis; }
+  private:
+    unsigned long _timeoutMillis = 1000;
+  };
+}
+
+class HTTPClient {
+public:
+  bool begin(BearSSL::WiFiClientSecure& client, const String& url) { _client = &client; _url = url; return true; }
+  void setTimeout(uint16_t timeoutMillis) { _timeoutMillis = timeoutMillis; }
+  void addHeader(const String&, const String&) {}
+  int POST(const String& body) { return hostHttpsPost(_url, body, min<uint32_t>(_timeoutMillis, _client->timeout())); }
+  void end() { _client = nullptr; }
+private:
+  BearSSL::WiFiClientSecure* _client = nullptr;
+  String _url;
+  uint16_t _timeoutMillis = 5000;
+};
@@ -0,0 +1,346 @@
+#pragma once
+
+// LittleFS, WiFiClient and ESP8266WebServer, as used by the web server code under
+// test.  The file system is held in memory, and counts what each request costs
+// it.  A connection's send buffer empties at the rate the network takes bytes,
+// as the clock advances; a write costs the CPU time the real one would, and a
+// blocking write waits for the buffer to empty, advancing the clock.
+
+#include <dirent.h>
+#include <map>
+#include <memory>
+#include <sys/stat.h>
+#include <vector>
+
+// ---- LittleFS ----
+
+struct HostFileData {
+  std::string content;
+  long lastWrite = 0; // seconds; zero when the file system did not record it
+};
+
+struct HostFSStats {
+  uint32_t opens = 0;
+  uint32_t exists = 0;
+  uint32_t dirs = 0;
+  uint64_t bytesRead = 0;
+};
+
+struct HostOpenFile {
+  std::string path;
+  HostFileData* data = nullptr;
+  size_t position = 0;
+  bool writing = false;
+  bool open = true;
+};
+
+HostFSStats& hostFSStats();
+
+class File {
+public:
+  File() {}
+  explicit File(std::shared_ptr<HostOpenFile> file) : _file(file) {}
+  operator bool() const { return _file && _file->open; }
+  size_t size() const { return *this ? _file->data->content.size() : 0; }
+  size_t position() const { return *this ? _file->position : 0; }
+  size_t read(uint8_t* buffer, size_t count) {
+    if (!*this) return 0;
+    count = min(count, _file->data->content.size() - _file->position);
+    memcpy(buffer, _file->data->content.data() + _file->position, count);
+    _file->position += count;
+    hostFSStats().bytesRead += count;
+    return count;
+  }
+  size_t write(const uint8_t* buffer, size_t count) {
+    if (!*this || !_file->writing) return 0;
+    _file->data->content.append(reinterpret_cast<const char*>(buffer), count);
+    return count;
+  }
+  int available() const { return *this ? (int)(_file->data->content.size() - _file->position) : 0; }
+  bool seek(size_t position) {
+    if (!*this || (position > _file->data->content.size())) return false;
+    _file->position = position;
+    return true;
+  }
+  // Stream's: up to terminator, which is read but not returned
+  String readStringUntil(char terminator) {
+    if (!*this) return String();
+    const std::string& content = _file->data->content;
+    const size_t end = min(content.find(terminator, _file->position), content.size());
+    String line(content.substr(_file->position, end - _file->position));
+    hostFSStats().bytesRead += min(end + 1, content.size()) - _file->position;
+    _file->position = min(end + 1, content.size());
+    return line;
+  }
+  void close() { if (_file) _file->open = false; }
+  const char* name() const { return _file->path.c_str() + _file->path.rfind('/') + 1; }
+  const char* fullName() const { return _file->path.c_str(); }
+  long getLastWrite() const { return _file->data->lastWrite; }
+private:
+  std::shared_ptr<HostOpenFile> _file;
+};
+
+struct HostDirEntry {
+  std::string name;
+  bool directory;
+  size_t size;
+  long lastWrite;
+};
+
+class Dir {
+public:
+  Dir() {}
+  Dir(const std::string& directory, std::vector<HostDirEntry> entries) : _directory(directory), _entries(entries) {}
+  bool next() { return ++_index < (int)_entries.size(); }
+  String fileName() const { return String(_entries[_index].name); }
+  bool isDirectory() const { return _entries[_index].directory; }
+  size_t fileSize() const { return _entries[_index].size; }
+  long fileTime() const { return _entries[_index].lastWrite; }
+  File openFile(const char* mode);
+private:
+  std::string _directory;
+  std::vector<HostDirEntry> _entries;
+  int _index = -1;
+};
+
+class HostFS {
+public:
+  std::map<std::string, HostFileData> files; // by full path
+  HostFSStats stats;
+  long now = 1600000000; // the write time given to files written by the code under test
+
+  File open(const String& path, const char* mode) {
+    stats.opens++;
+    const bool writing = (mode[0] == 'w');
+    std::map<std::string, HostFileData>::iterator found = files.find(path.c_str());
+    if (found == files.end()) {
+      if (!writing) return File();
+      found = files.insert(std::make_pair(std::string(path.c_str()), HostFileData())).first;
+    }
+    if (writing) {
+      found->second.content.clear();
+      found->second.lastWrite = now;
+    }
+    std::shared_ptr<HostOpenFile> file(new HostOpenFile());
+    file->path = found->first;
+    file->data = &found->second;
+    file->writing = writing;
+    return File(file);
+  }
+  bool exists(const String& path) {
+    stats.exists++;
+    return files.count(path.c_str()) != 0;
+  }
+  bool remove(const String& path) { return files.erase(path.c_str()) != 0; }
+
+  // Immediate children of directory (which ends with "/"), files and directories
+  Dir openDir(const String& directory) {
+    stats.dirs++;
+    std::string prefix = directory.c_str();
+    if (prefix.empty() || (prefix[prefix.size() - 1] != '/')) prefix += '/';
+    std::vector<HostDirEntry> entries;
+    for (std::map<std::string, HostFileData>::iterator i = files.begin(); i != files.end(); ++i) {
+      if (i->first.compare(0, prefix.size(), prefix) != 0) continue;
+      const std::string rest = i->first.substr(prefix.size());
+      const size_t slash = rest.find('/');
+      if (slash == std::string::npos) {
+        entries.push_back(HostDirEntry { rest, false, i->second.content.size(), i->second.lastWrite });
+      } else if (entries.empty() || (entries.back().name != rest.substr(0, slash))) {
+        entries.push_back(HostDirEntry { rest.substr(0, slash), true, 0, 0 });
+      }
+    }
+    return Dir(prefix, entries);
+  }
+};
+static HostFS LittleFS;
+#define MYFS LittleFS
+
+inline HostFSStats& hostFSStats() { return LittleFS.stats; }
+
+// Copies a directory of the host into the file system at path, with write times
+// counting up from 1600000000; returns the number of bytes copied
+inline uint64_t hostCopyDirectory(const std::string& directory, const std::string& path) {
+  uint64_t bytes = 0;
+  DIR* dir = opendir(directory.c_str());
+  while (struct dirent* entry = (dir != nullptr) ? readdir(dir) : nullptr) {
+    const std::string name = entry->d_name;
+    if ((name == ".") || (name == "..")) continue;
+    const std::string full = directory + "/" + name;
+    struct stat info;
+    stat(full.c_str(), &info);
+    if (S_ISDIR(info.st_mode)) {
+      bytes += hostCopyDirectory(full, path + name + "/");
+      continue;
+    }
+    FILE* file = fopen(full.c_str(), "rb");
+    HostFileData& data = LittleFS.files[path + name];
+    data.content.resize(info.st_size);
+    data.content.resize(fread(&data.content[0], 1, info.st_size, file));
+    fclose(file);
+    data.lastWrite = 1600000000 + (long)LittleFS.files.size();
+    bytes += data.content.size();
+  }
+  if (dir != nullptr) closedir(dir);
+  return bytes;
+}
+
+// The web app (data/), as uploaded by `pio run -t uploadfs`
+inline uint64_t hostLoadWebApp() {
+  LittleFS.files.clear();
+  std::string source = __FILE__;
+  source = source.substr(0, source.rfind('/') + 1) + "../../esp8266-fastled-webserver/data";
+  return hostCopyDirectory(source, "/");
+}
+
+inline File Dir::openFile(const char* mode) {
+  return LittleFS.open(String((_directory + _entries[_index].name).c_str()), mode);
+}
+
+// ---- WiFiClient ----
+
+// How fast the network takes bytes, and what a write costs the CPU
+struct HostNetwork {
+  uint32_t sendBufferBytes = 2920;  // lwIP's TCP_SND_BUF on ESP8266, two segments
+  uint32_t bytesPerMilli = 1000;    // about 8 Mbit/s of WiFi
+  uint32_t writeNanosPerByte = 100; // copying into lwIP, from RAM or flash
+};
+inline HostNetwork& hostNetwork() { static HostNetwork network; return network; }
+
+struct HostConnection {
+  bool connected = true;
+  std::string received;   // everything written, headers included
+  uint32_t unacknowledged = 0;
+  uint32_t updatedMicros = 0;
+
+  void update() {
+    const uint32_t now = micros();
+    const uint64_t acknowledged = (uint64_t)(now - updatedMicros) * hostNetwork().bytesPerMilli / 1000;
+    if (acknowledged > 0) {
+      unacknowledged -= (uint32_t)min<uint64_t>(acknowledged, unacknowledged);
+      updatedMicros = now;
+    }
+  }
+};
+
+class WiFiClient {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(std::shared_ptr<HostConnection> connection) : _connection(connection) {}
+  bool connected() const { return _connection && _connection->connected; }
+  void stop() { if (_connection) _connection->connected = false; }
+  size_t availableForWrite() {
+    if (!connected()) return 0;
+    _connection->update();
+    return hostNetwork().sendBufferBytes - _connection->unacknowledged;
+  }
+  size_t write(const uint8_t* bytes, size_t count) {
+    count = min(count, availableForWrite());
+    if (count == 0) return 0;
+    _connection->received.append(reinterpret_cast<const char*>(bytes), count);
+    _connection->unacknowledged += count;
+    hostAdvanceMicros((uint32_t)((uint64_t)count * hostNetwork().writeNanosPerByte / 1000));
+    return count;
+  }
+  size_t write_P(PGM_P bytes, size_t count) { return write(reinterpret_cast<const uint8_t*>(bytes), count); }
+
+  // Blocks until everything is sent, as the real client does
+  size_t writeAll(const uint8_t* bytes, size_t count) {
+    size_t sent = 0;
+    while (connected() && (sent < count)) {
+      const size_t written = write(bytes + sent, count - sent);
+      if (written == 0) {
+        delay(1); // waiting for acknowledgements
+      }
+      sent += written;
+    }
+    return sent;
+  }
+  size_t write(File& file) {
+    std::vector<uint8_t> buffer(file.size() - file.position());
+    const size_t count = file.read(buffer.data(), buffer.size());
+    return writeAll(buffer.data(), count);
+  }
+
+  std::shared_ptr<HostConnection> connection() const { return _connection; }
+private:
+  std::shared_ptr<HostConnection> _connection;
+};
+
+// ---- ESP8266WebServer ----
+
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+
+struct HTTPUpload {
+  HTTPUploadStatus status;
+  String filename;
+  size_t totalSize;
+  size_t currentSize;
+  uint8_t buf[1460];
+};
+
+// One request at a time: a test sets it up with request(), then calls the handler
+class HostWebServer {
+public:
+  int code = 0;
+  String contentType;
+  String content;
+  std::map<String, String> responseHeaders;
+  size_t contentLength = 0;
+
+  WiFiClient request(const String& uri, const std::map<String, String>& args = std::map<String, String>(),
+                     const std::map<String, String>& headers = std::map<String, String>()) {
+    _uri = uri;
+    _args = args;
+    _headers = headers;
+    code = 0;
+    contentType = String();
+    content = String();
+    responseHeaders.clear();
+    contentLength = 0;
+    std::shared_ptr<HostConnection> connection(new HostConnection());
+    connection->updatedMicros = micros();
+    _client = WiFiClient(connection);
+    return _client;
+  }
+
+  const String& uri() const { return _uri; }
+  bool hasArg(const String& name) const { return _args.count(name) != 0; }
+  String arg(const String& name) const { return hasArg(name) ? _args.find(name)->second : String(); }
+  String arg(int index) const { std::map<String, String>::const_iterator i = _args.begin(); std::advance(i, index); return i->second; }
+  int args() const { return (int)_args.size(); }
+  String header(const String& name) const { return (_headers.count(name) != 0) ? _headers.find(name)->second : String(); }
+  HTTPUpload& upload() { return _upload; }
+  WiFiClient& client() { return _client; }
+
+  void sendHeader(const String& name, const String& value) { responseHeaders[name] = value; }
+  void setContentLength(size_t length) { contentLength = length; }
+  void send(int status, const String& type = String(), const String& body = String()) {
+    code = status;
+    contentType = type;
+    content = body;
+    String head = "HTTP/1.1 " + String(status) + "\r\n";
+    for (std::map<String, String>::iterator i = responseHeaders.begin(); i != responseHeaders.end(); ++i) {
+      head += i->first + ": " + i->second + "\r\n";
+    }
+    head += "\r\n";
+    _client.writeAll(reinterpret_cast<const uint8_t*>(head.c_str()), head.length());
+    _client.writeAll(reinterpret_cast<const uint8_t*>(body.c_str()), body.length());
+  }
+  void sendContent_P(PGM_P bytes, size_t count) { _client.writeAll(reinterpret_cast<const uint8_t*>(bytes), count); }
+  size_t streamFile(File& file, const String& type) {
+    if (String(file.fullName()).endsWith(".gz") && (type != "application/x-gzip") && (type != "application/octet-stream")) {
+      sendHeader("Content-Encoding", "gzip");
+    }
+    setContentLength(file.size());
+    send(200, type, String());
+    return _client.write(file);
+  }
+
+private:
+  String _uri;
+  std::map<String, String> _args;
+  std::map<String, String> _headers;
+  HTTPUpload _upload;
+  WiFiClient _client;
+};
+typedef HostWebServer ESP8266WebServer;
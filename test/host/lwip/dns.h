@@ -0,0 +1,46 @@
+#pragma once
+
+// lwIP's asynchronous DNS lookup.  The name is in the cache unless a test says
+// otherwise; then the lookup is answered when the test calls hostDnsAnswer().
+
+typedef int8_t err_t;
+#define ERR_OK          0
+#define ERR_INPROGRESS -5
+#define ERR_ARG        -16
+
+typedef struct { uint32_t addr; } ip_addr_t;
+typedef void (*dns_found_callback)(const char* name, const ip_addr_t* address, void* argument);
+
+struct HostDns {
+  bool cached = true;
+  uint32_t lookups = 0;
+  const char* pendingName = nullptr;
+  dns_found_callback pendingCallback = nullptr;
+  void* pendingArgument = nullptr;
+};
+
+inline HostDns& hostDns() { static HostDns dns; return dns; }
+
+inline err_t dns_gethostbyname(const char* name, ip_addr_t* address, dns_found_callback found, void* argument) {
+  HostDns& dns = hostDns();
+  dns.lookups++;
+  if (dns.cached) {
+    address->addr = 0x0100007F; // 127.0.0.1
+    return ERR_OK;
+  }
+  dns.pendingName = name;
+  dns.pendingCallback = found;
+  dns.pendingArgument = argument;
+  return ERR_INPROGRESS;
+}
+
+// Answers the pending lookup, which puts the name in the cache when found
+inline void hostDnsAnswer(bool found) {
+  HostDns& dns = hostDns();
+  if (dns.pendingCallback == nullptr) return;
+  const ip_addr_t address = { 0x0100007F };
+  const dns_found_callback callback = dns.pendingCallback;
+  dns.pendingCallback = nullptr;
+  dns.cached = found;
+  callback(dns.pendingName, found ? &address : nullptr, dns.pendingArgument);
+}
@@ -0,0 +1,404 @@
+// IR input (commands.cpp): readCommand() decodes a code per call without
+// waiting, and tells a press from a held key by time; each built-in remote's
+// sorted PROGMEM keymap, and keys loaded from /remotes.txt, map every code to the
+// command the switch statements before them did.
+
+#include <unity.h>
+
+#include <string>
+
+#define ENABLE_IR 1
+#define IR_RECV_PIN 14
+#define FRAMES_PER_SECOND 60
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/include/EnergyGovernor.hpp"
+
+// What handleIrInput() calls in the sketch
+uint8_t power = 1;
+uint8_t autoplay = 0;
+CRGB solidColor;
+void setPower(uint8_t value) { power = value; }
+void setAutoplay(uint8_t value) { autoplay = value; }
+void setSolidColor(CRGB color) { solidColor = color; }
+void adjustPattern(bool) {}
+void setPattern(uint8_t) {}
+void adjustBrightness(bool) {}
+
+#include "../../esp8266-fastled-webserver/Log.cpp"
+#include "../../esp8266-fastled-webserver/commands.cpp"
+
+// getCommand() before the keymaps: a switch statement per remote
+namespace baseline {
+
+InputCommand getCommand(unsigned long input) {
+  if (adafruitRemoteEnabled) {
+    switch (input) {
+      case IRCODE_ADAFRUIT_UP:
+        return InputCommand::Up;
+
+      case IRCODE_ADAFRUIT_DOWN:
+        return InputCommand::Down;
+
+      case IRCODE_ADAFRUIT_LEFT:
+        return InputCommand::Left;
+
+      case IRCODE_ADAFRUIT_RIGHT:
+        return InputCommand::Right;
+
+      case IRCODE_ADAFRUIT_ENTER_SAVE:
+        return InputCommand::Select;
+
+      case IRCODE_ADAFRUIT_STOP_MODE:
+      case IRCODE_ADAFRUIT_1:
+        return InputCommand::PlayMode;
+
+      case IRCODE_ADAFRUIT_2:
+        return InputCommand::Palette;
+
+      case IRCODE_ADAFRUIT_PLAY_PAUSE:
+        return InputCommand::Power;
+
+      case IRCODE_ADAFRUIT_VOLUME_UP:
+        return InputCommand::BrightnessUp;
+
+      case IRCODE_ADAFRUIT_VOLUME_DOWN:
+        return InputCommand::BrightnessDown;
+    }
+  }
+
+  if (sparkfunRemoteEnabled) {
+    switch (input) {
+      case IRCODE_SPARKFUN_UP:
+        return InputCommand::Up;
+
+      case IRCODE_SPARKFUN_DOWN:
+        return InputCommand::Down;
+
+      case IRCODE_SPARKFUN_LEFT:
+        return InputCommand::Left;
+
+      case IRCODE_SPARKFUN_RIGHT:
+        return InputCommand::Right;
+
+      case IRCODE_SPARKFUN_SELECT:
+        return InputCommand::Select;
+
+      case IRCODE_SPARKFUN_POWER:
+        return InputCommand::Brightness;
+
+      case IRCODE_SPARKFUN_A:
+        return InputCommand::PlayMode;
+
+      case IRCODE_SPARKFUN_B:
+        return InputCommand::Palette;
+    }
+  }
+
+  if (etopxizuRemoteEnabled) {
+    switch (input) {
+      case IRCODE_ETOPXIZU_QUICK:
+        return InputCommand::Up;
+
+      case IRCODE_ETOPXIZU_SLOW:
+        return InputCommand::Down;
+
+      case IRCODE_ETOPXIZU_PLAY_PAUSE:
+        return InputCommand::PlayMode;
+
+      case IRCODE_ETOPXIZU_POWER:
+        return InputCommand::Power;
+
+      case IRCODE_ETOPXIZU_BRIGHTNESS_UP:
+        return InputCommand::BrightnessUp;
+      case IRCODE_ETOPXIZU_BRIGHTNESS_DOWN:
+        return InputCommand::BrightnessDown;
+
+      case IRCODE_ETOPXIZU_DIY1:
+        return InputCommand::Pattern1;
+      case IRCODE_ETOPXIZU_DIY2:
+        return InputCommand::Pattern2;
+      case IRCODE_ETOPXIZU_DIY3:
+        return InputCommand::Pattern3;
+      case IRCODE_ETOPXIZU_DIY4:
+        return InputCommand::Pattern4;
+      case IRCODE_ETOPXIZU_DIY5:
+        return InputCommand::Pattern5;
+      case IRCODE_ETOPXIZU_DIY6:
+        return InputCommand::Pattern6;
+      case IRCODE_ETOPXIZU_JUMP3:
+        return InputCommand::Pattern7;
+      case IRCODE_ETOPXIZU_JUMP7:
+        return InputCommand::Pattern8;
+      case IRCODE_ETOPXIZU_FADE3:
+        return InputCommand::Pattern9;
+      case IRCODE_ETOPXIZU_FADE7:
+        return InputCommand::Pattern10;
+      case IRCODE_ETOPXIZU_FLASH:
+        return InputCommand::Pattern11;
+      case IRCODE_ETOPXIZU_AUTO:
+        return InputCommand::Pattern12;
+
+      case IRCODE_ETOPXIZU_RED_UP:
+        return InputCommand::RedUp;
+      case IRCODE_ETOPXIZU_RED_DOWN:
+        return InputCommand::RedDown;
+
+      case IRCODE_ETOPXIZU_GREEN_UP:
+        return InputCommand::GreenUp;
+      case IRCODE_ETOPXIZU_GREEN_DOWN:
+        return InputCommand::GreenDown;
+
+      case IRCODE_ETOPXIZU_BLUE_UP:
+        return InputCommand::BlueUp;
+      case IRCODE_ETOPXIZU_BLUE_DOWN:
+        return InputCommand::BlueDown;
+
+      case IRCODE_ETOPXIZU_RED:
+        return InputCommand::Red;
+      case IRCODE_ETOPXIZU_RED_ORANGE:
+        return InputCommand::RedOrange;
+      case IRCODE_ETOPXIZU_ORANGE:
+        return InputCommand::Orange;
+      case IRCODE_ETOPXIZU_YELLOW_ORANGE:
+        return InputCommand::YellowOrange;
+      case IRCODE_ETOPXIZU_YELLOW:
+        return InputCommand::Yellow;
+
+      case IRCODE_ETOPXIZU_GREEN:
+        return InputCommand::Green;
+      case IRCODE_ETOPXIZU_LIME:
+        return InputCommand::Lime;
+      case IRCODE_ETOPXIZU_AQUA:
+        return InputCommand::Aqua;
+      case IRCODE_ETOPXIZU_TEAL:
+        return InputCommand::Teal;
+      case IRCODE_ETOPXIZU_NAVY:
+        return InputCommand::Navy;
+
+      case IRCODE_ETOPXIZU_BLUE:
+        return InputCommand::Blue;
+      case IRCODE_ETOPXIZU_ROYAL_BLUE:
+        return InputCommand::RoyalBlue;
+      case IRCODE_ETOPXIZU_PURPLE:
+        return InputCommand::Purple;
+      case IRCODE_ETOPXIZU_INDIGO:
+        return InputCommand::Indigo;
+      case IRCODE_ETOPXIZU_MAGENTA:
+        return InputCommand::Magenta;
+
+      case IRCODE_ETOPXIZU_WHITE:
+        return InputCommand::White;
+      case IRCODE_ETOPXIZU_PINK:
+        return InputCommand::Pink;
+      case IRCODE_ETOPXIZU_LIGHT_PINK:
+        return InputCommand::LightPink;
+      case IRCODE_ETOPXIZU_BABY_BLUE:
+        return InputCommand::BabyBlue;
+      case IRCODE_ETOPXIZU_LIGHT_BLUE:
+        return InputCommand::LightBlue;
+    }
+  }
+
+  return InputCommand::None;
+}
+
+} // namespace baseline
+
+// Every code of the built-in remotes, but their held codes
+static const uint32_t CODES[] = {
+  IRCODE_SPARKFUN_POWER, IRCODE_SPARKFUN_A, IRCODE_SPARKFUN_B, IRCODE_SPARKFUN_C,
+  IRCODE_SPARKFUN_UP, IRCODE_SPARKFUN_LEFT, IRCODE_SPARKFUN_SELECT, IRCODE_SPARKFUN_RIGHT, IRCODE_SPARKFUN_DOWN,
+
+  IRCODE_ADAFRUIT_VOLUME_UP, IRCODE_ADAFRUIT_PLAY_PAUSE, IRCODE_ADAFRUIT_VOLUME_DOWN, IRCODE_ADAFRUIT_SETUP,
+  IRCODE_ADAFRUIT_UP, IRCODE_ADAFRUIT_STOP_MODE, IRCODE_ADAFRUIT_LEFT, IRCODE_ADAFRUIT_ENTER_SAVE,
+  IRCODE_ADAFRUIT_RIGHT, IRCODE_ADAFRUIT_0_10_PLUS, IRCODE_ADAFRUIT_DOWN, IRCODE_ADAFRUIT_BACK,
+  IRCODE_ADAFRUIT_1, IRCODE_ADAFRUIT_2, IRCODE_ADAFRUIT_3, IRCODE_ADAFRUIT_4, IRCODE_ADAFRUIT_5,
+  IRCODE_ADAFRUIT_6, IRCODE_ADAFRUIT_7, IRCODE_ADAFRUIT_8, IRCODE_ADAFRUIT_9,
+
+  IRCODE_ETOPXIZU_POWER, IRCODE_ETOPXIZU_PLAY_PAUSE, IRCODE_ETOPXIZU_BRIGHTNESS_UP, IRCODE_ETOPXIZU_BRIGHTNESS_DOWN,
+  IRCODE_ETOPXIZU_DIY1, IRCODE_ETOPXIZU_DIY2, IRCODE_ETOPXIZU_DIY3, IRCODE_ETOPXIZU_DIY4, IRCODE_ETOPXIZU_DIY5, IRCODE_ETOPXIZU_DIY6,
+  IRCODE_ETOPXIZU_JUMP3, IRCODE_ETOPXIZU_JUMP7, IRCODE_ETOPXIZU_FADE3, IRCODE_ETOPXIZU_FADE7,
+  IRCODE_ETOPXIZU_FLASH, IRCODE_ETOPXIZU_AUTO, IRCODE_ETOPXIZU_QUICK, IRCODE_ETOPXIZU_SLOW,
+  IRCODE_ETOPXIZU_RED_UP, IRCODE_ETOPXIZU_RED_DOWN, IRCODE_ETOPXIZU_GREEN_UP, IRCODE_ETOPXIZU_GREEN_DOWN,
+  IRCODE_ETOPXIZU_BLUE_UP, IRCODE_ETOPXIZU_BLUE_DOWN,
+  IRCODE_ETOPXIZU_RED, IRCODE_ETOPXIZU_RED_ORANGE, IRCODE_ETOPXIZU_ORANGE, IRCODE_ETOPXIZU_YELLOW_ORANGE, IRCODE_ETOPXIZU_YELLOW,
+  IRCODE_ETOPXIZU_GREEN, IRCODE_ETOPXIZU_LIME, IRCODE_ETOPXIZU_AQUA, IRCODE_ETOPXIZU_TEAL, IRCODE_ETOPXIZU_NAVY,
+  IRCODE_ETOPXIZU_BLUE, IRCODE_ETOPXIZU_ROYAL_BLUE, IRCODE_ETOPXIZU_PURPLE, IRCODE_ETOPXIZU_INDIGO, IRCODE_ETOPXIZU_MAGENTA,
+  IRCODE_ETOPXIZU_WHITE, IRCODE_ETOPXIZU_PINK, IRCODE_ETOPXIZU_LIGHT_PINK, IRCODE_ETOPXIZU_BABY_BLUE, IRCODE_ETOPXIZU_LIGHT_BLUE,
+
+  0x00FF629D, 0, // of no remote
+};
+static const uint16_t CODE_COUNT = sizeof(CODES) / sizeof(CODES[0]);
+
+static void enableRemotes(uint8_t mask) {
+  sparkfunRemoteEnabled = mask & 1;
+  adafruitRemoteEnabled = mask & 2;
+  etopxizuRemoteEnabled = mask & 4;
+}
+
+// Drops the keys of a remotes file, as at boot
+static void unloadIrRemotes() {
+  free(fileKeys);
+  fileKeys = nullptr;
+  fileKeyCount = 0;
+}
+
+// The code, as the remote sends it after millis, and what readCommand() makes of it
+static InputCommand sendAfter(uint32_t millis, uint32_t code, bool repeat = false) {
+  hostMillis() += millis;
+  hostIrSend(code, repeat);
+  const InputCommand command = readCommand();
+  return command;
+}
+
+// Ends a test with every key released
+static void releaseAll() {
+  hostMillis() += IR_RELEASE_MILLIS;
+}
+
+void setUp(void) {
+  enableRemotes(7);
+  hostIrCodes().clear();
+  LittleFS.files.clear();
+}
+
+void tearDown(void) {
+  releaseAll();
+  unloadIrRemotes();
+}
+
+void test_keymaps_match_switches(void) {
+  for (uint8_t mask = 0; mask < 8; mask++) {
+    enableRemotes(mask);
+    for (uint16_t i = 0; i < CODE_COUNT; i++) {
+      TEST_ASSERT_EQUAL_UINT8((uint8_t)baseline::getCommand(CODES[i]), (uint8_t)getCommand(CODES[i]));
+    }
+  }
+  // held codes are a command of their own now; before, readIRCode(holdDelay) took them apart
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Repeat, (uint8_t)getCommand(IRCODE_SPARKFUN_HELD));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Repeat, (uint8_t)getCommand(IRCODE_ADAFRUIT_HELD));
+}
+
+// A remotes file listing every code with the command the switches gave it maps
+// them the same, with the built-in remotes off
+void test_remotes_file_matches_switches(void) {
+  InputCommand expected[CODE_COUNT];
+  std::string file = "# every built-in key\n\n";
+  for (uint16_t i = 0; i < CODE_COUNT; i++) {
+    const InputCommand command = expected[i] = baseline::getCommand(CODES[i]);
+    if (command == InputCommand::None) {
+      continue;
+    }
+    const char* name = inputCommandNames;
+    for (uint8_t n = 0; n < static_cast<uint8_t>(command); n++) {
+      name += strlen(name) + 1;
+    }
+    char line[64];
+    snprintf(line, sizeof(line), (i % 2) ? "0x%08X %s\n" : "%u\t%s   # decimal\r\n", (unsigned)CODES[i], name);
+    file += line;
+  }
+  file += "0x00FF629D Sideways\nnot a key\n0x00FF629E None\n";
+  LittleFS.files[IR_REMOTES_FILE_PATH].content = file;
+
+  TEST_ASSERT_TRUE(loadIrRemotes());
+  enableRemotes(0);
+  for (uint16_t i = 0; i < CODE_COUNT; i++) {
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)expected[i], (uint8_t)getCommand(CODES[i]));
+  }
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)getCommand(0x00FF629E));
+
+  // the file takes precedence over a built-in remote
+  unloadIrRemotes();
+  LittleFS.files[IR_REMOTES_FILE_PATH].content = "0x00FD40BF Pattern3\n";
+  TEST_ASSERT_TRUE(loadIrRemotes());
+  enableRemotes(7);
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Pattern3, (uint8_t)getCommand(IRCODE_ADAFRUIT_VOLUME_UP));
+}
+
+void test_no_remotes_file(void) {
+  TEST_ASSERT_FALSE(loadIrRemotes());
+  LittleFS.files[IR_REMOTES_FILE_PATH].content = "# nothing\n";
+  TEST_ASSERT_FALSE(loadIrRemotes());
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Up, (uint8_t)getCommand(IRCODE_SPARKFUN_UP));
+}
+
+// Nothing received: returns at once
+void test_idle_does_not_wait(void) {
+  const uint32_t start = micros();
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)readCommand());
+  TEST_ASSERT_EQUAL_UINT32(start, micros());
+}
+
+// A press is a command at once; before, it waited out the release
+void test_press(void) {
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Up, (uint8_t)sendAfter(0, IRCODE_SPARKFUN_UP));
+  // the held code, about every 108 ms, while held
+  for (int i = 0; i < 20; i++) {
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)sendAfter(108, IRCODE_SPARKFUN_HELD));
+  }
+  // a remote resending the code itself, or a protocol repeat frame
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)sendAfter(108, IRCODE_SPARKFUN_UP));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)sendAfter(108, 0xFFFFFFFF, true));
+  // another key within the release time is a press
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Left, (uint8_t)sendAfter(108, IRCODE_SPARKFUN_LEFT));
+}
+
+// After IR_RELEASE_MILLIS without a code the key was released: the same key again
+// is a press, and a held code alone is ignored
+void test_release_after_150ms(void) {
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Up, (uint8_t)sendAfter(0, IRCODE_SPARKFUN_UP));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)sendAfter(149, IRCODE_SPARKFUN_UP));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Up, (uint8_t)sendAfter(150, IRCODE_SPARKFUN_UP));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)sendAfter(150, IRCODE_SPARKFUN_HELD));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)sendAfter(108, IRCODE_SPARKFUN_HELD));
+}
+
+// The adjustment keys repeat on every code once held for IR_HOLD_MILLIS
+void test_hold_repeats_after_500ms(void) {
+  const uint32_t start = millis();
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::BrightnessUp, (uint8_t)sendAfter(0, IRCODE_ETOPXIZU_BRIGHTNESS_UP));
+  uint8_t repeats = 0;
+  for (int i = 0; i < 10; i++) {
+    const InputCommand command = sendAfter(108, IRCODE_ETOPXIZU_HELD);
+    const bool holding = (millis() - start >= IR_HOLD_MILLIS);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(holding ? InputCommand::BrightnessUp : InputCommand::None), (uint8_t)command);
+    repeats += holding;
+  }
+  TEST_ASSERT_EQUAL_UINT8(6, repeats); // at 540, 648, ... 1080 ms
+  releaseAll();
+
+  // a key that is not an adjustment does not
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::Power, (uint8_t)sendAfter(0, IRCODE_ETOPXIZU_POWER));
+  for (int i = 0; i < 10; i++) {
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)InputCommand::None, (uint8_t)sendAfter(108, IRCODE_ETOPXIZU_HELD));
+  }
+}
+
+// handleIrInput() acts on a press once
+void test_handle_ir_input(void) {
+  power = 1;
+  hostIrSend(IRCODE_ADAFRUIT_PLAY_PAUSE);
+  handleIrInput();
+  TEST_ASSERT_EQUAL_UINT8(0, power);
+  hostMillis() += 108;
+  hostIrSend(IRCODE_ADAFRUIT_HELD);
+  handleIrInput();
+  TEST_ASSERT_EQUAL_UINT8(0, power);
+  hostMillis() += 108;
+  hostIrSend(IRCODE_ETOPXIZU_AQUA);
+  handleIrInput();
+  TEST_ASSERT_TRUE(solidColor == CRGB(CRGB::Aqua));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_keymaps_match_switches);
+  RUN_TEST(test_remotes_file_matches_switches);
+  RUN_TEST(test_no_remotes_file);
+  RUN_TEST(test_idle_does_not_wait);
+  RUN_TEST(test_press);
+  RUN_TEST(test_release_after_150ms);
+  RUN_TEST(test_hold_repeats_after_500ms);
+  RUN_TEST(test_handle_ir_input);
+  return UNITY_END();
+}
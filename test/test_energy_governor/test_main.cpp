@@ -0,0 +1,135 @@
+// The energy governor's frame period (EnergyGovernor.cpp), under render load.
+// Before, frames that took longer to render and show than 1000 / FRAMES_PER_SECOND
+// followed each other with no sleep at all, at whatever rate the pattern managed.
+// Now the period is stretched to a fifth more than the measured load, so frames
+// stay evenly spaced with time left to sleep, and shrinks back once the load falls.
+
+#include <unity.h>
+
+#include <stdio.h>
+
+#define ENERGY_GOVERNOR 1
+#define FRAMES_PER_SECOND 60
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/include/EnergyGovernor.hpp"
+#include "../../esp8266-fastled-webserver/Log.cpp"
+#include "../../esp8266-fastled-webserver/EnergyGovernor.cpp"
+#include "../../esp8266-fastled-webserver/Transfers.cpp" // sent while the governor sleeps; none here
+
+ESP8266WebServer webServer;
+CRGB leds[NUM_PIXELS];
+
+static const uint32_t SHOW_MICROS    = 7700;  // 256 pixels of WS2812
+static const uint32_t ON_TIME_MICROS = 4000;  // a pattern drawn well within the frame period
+static const uint32_t HEAVY_MICROS   = 25000; // one that is not
+
+static RenderParameters parameters;
+
+typedef struct {
+  uint32_t framesPerSecond;
+  uint32_t maxFrameGapMillis;
+  uint32_t sleepPercent;      // of the time, in the governor's sleep
+  uint32_t framePeriodMillis; // at the end
+} Run;
+
+// loop() for millis, drawing a new frame whenever one is due
+static void run(Run& result, uint32_t renderMicros, uint32_t millis) {
+  stats.maxFrameGapMillis = 0;
+  previousFrameActive = false;
+  const uint32_t start = hostMillis();
+  const uint32_t sleepStart = governorStats().sleepMillis;
+  uint32_t frames = 0;
+  while (hostMillis() - start < millis) {
+    if (!governorBeginFrame(parameters)) {
+      governorWait();
+      continue;
+    }
+    leds[0].r++; // the pattern animates
+    hostAdvanceMicros(renderMicros);
+    governorFrameDrawn();
+    governorShowAndWait();
+    frames++;
+  }
+  result.framesPerSecond = frames * 1000 / (hostMillis() - start);
+  const GovernorStats governor = governorStats();
+  result.maxFrameGapMillis = governor.maxFrameGapMillis;
+  result.sleepPercent = (governor.sleepMillis - sleepStart) * 100 / (hostMillis() - start);
+  result.framePeriodMillis = governor.framePeriodMillis;
+}
+
+static void report(const char* name, const Run& result) {
+  char message[160];
+  snprintf(message, sizeof(message), "%-18s %3u frames/s, frame gap %3u ms, period %3u ms, %2u%% asleep",
+           name, (unsigned)result.framesPerSecond, (unsigned)result.maxFrameGapMillis,
+           (unsigned)result.framePeriodMillis, (unsigned)result.sleepPercent);
+  TEST_MESSAGE(message);
+}
+
+void setUp(void) {
+  FastLED.showMicros = SHOW_MICROS;
+  parameters = RenderParameters { 1, 255, 0, 0, CRGB(0, 0, 0) };
+  framePeriodMillis = FRAME_MILLIS;
+  resetLoad();
+  Run settle;
+  run(settle, ON_TIME_MICROS, 100); // into the active state
+  framePeriodMillis = FRAME_MILLIS;
+  resetLoad();
+}
+void tearDown(void) {}
+
+void test_frames_on_time_keep_the_period(void) {
+  Run result;
+  run(result, ON_TIME_MICROS, 3000);
+  run(result, ON_TIME_MICROS, 1000);
+  report("on time", result);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_MILLIS, result.framePeriodMillis);
+  TEST_ASSERT_UINT32_WITHIN(1, FRAME_MILLIS, result.maxFrameGapMillis);
+  TEST_ASSERT_UINT32_WITHIN(1, 1000 / FRAME_MILLIS, result.framesPerSecond);
+}
+
+// The first second runs back to back, as before; after it, at the stretched period
+void test_heavy_frames_stretch_the_period(void) {
+  const uint32_t busyMillis = (HEAVY_MICROS + SHOW_MICROS) / 1000;
+  Run before, after;
+  run(before, HEAVY_MICROS, 900);
+  report("heavy, before", before);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_MILLIS, before.framePeriodMillis);
+  TEST_ASSERT_EQUAL_UINT32(0, before.sleepPercent);
+
+  run(after, HEAVY_MICROS, 100); // the rest of the first second
+  run(after, HEAVY_MICROS, 3000);
+  report("heavy, after", after);
+  TEST_ASSERT_TRUE(after.framePeriodMillis > busyMillis);
+  TEST_ASSERT_TRUE(after.framePeriodMillis <= busyMillis * 5 / 4 + 2);
+  TEST_ASSERT_UINT32_WITHIN(1, after.framePeriodMillis, after.maxFrameGapMillis);
+  TEST_ASSERT_TRUE(after.sleepPercent >= 10);
+}
+
+void test_period_shrinks_back_when_the_load_falls(void) {
+  Run result;
+  run(result, HEAVY_MICROS, 3000);
+  TEST_ASSERT_TRUE(result.framePeriodMillis > FRAME_MILLIS);
+  run(result, ON_TIME_MICROS, 3000);
+  run(result, ON_TIME_MICROS, 1000);
+  report("load fell", result);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_MILLIS, result.framePeriodMillis);
+  TEST_ASSERT_UINT32_WITHIN(1, FRAME_MILLIS, result.maxFrameGapMillis);
+}
+
+// A pattern slower than the longest period still overruns it, as before
+void test_period_is_bounded(void) {
+  Run result;
+  run(result, 150000, 3000);
+  report("150 ms render", result);
+  TEST_ASSERT_EQUAL_UINT32(MAX_FRAME_MILLIS, result.framePeriodMillis);
+  TEST_ASSERT_EQUAL_UINT32(0, result.sleepPercent);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_on_time_keep_the_period);
+  RUN_TEST(test_heavy_frames_stretch_the_period);
+  RUN_TEST(test_period_shrinks_back_when_the_load_falls);
+  RUN_TEST(test_period_is_bounded);
+  return UNITY_END();
+}
@@ -0,0 +1,136 @@
+// forkJoinPixelRanges() (ForkJoin.cpp), with its worker task on a second std::thread:
+// the split covers every pixel exactly once, matches a single-range pass, and the
+// speedup on a noise-like kernel.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#define PARALLEL_PIXEL_KERNELS 1
+#include "../../esp8266-fastled-webserver/ForkJoin.cpp"
+
+static const uint16_t PIXELS = 1024;
+
+// A stand-in for drawNoise() per pixel: octaves of 2D value noise.  Eight octaves
+// bring the host's work per pixel to roughly the ratio of ESP32 render time to
+// task notification overhead.
+static uint8_t hash8(uint16_t x, uint16_t y) {
+  uint32_t h = x * 374761393u + y * 668265263u;
+  h = (h ^ (h >> 13)) * 1274126177u;
+  return (uint8_t)(h >> 24);
+}
+
+static uint8_t valueNoise(uint16_t x, uint16_t y) {
+  const uint16_t cellX = x >> 8, cellY = y >> 8;
+  const uint8_t fx = x & 0xFF, fy = y & 0xFF;
+  const int16_t top    = hash8(cellX, cellY)     + (((hash8(cellX + 1, cellY)     - hash8(cellX, cellY))     * fx) >> 8);
+  const int16_t bottom = hash8(cellX, cellY + 1) + (((hash8(cellX + 1, cellY + 1) - hash8(cellX, cellY + 1)) * fx) >> 8);
+  return (uint8_t)(top + (((bottom - top) * fy) >> 8));
+}
+
+struct NoiseFrame {
+  uint8_t* out;
+  uint16_t frame;
+  void operator()(uint16_t first, uint16_t last) {
+    for (uint16_t i = first; i < last; i++) {
+      const uint16_t x = (i % 32) << 7, y = (i / 32) << 7;
+      uint16_t sum = 0;
+      for (uint8_t octave = 0; octave < 8; octave++) {
+        sum += valueNoise((x << octave) + frame * (octave + 1), (y << octave) + frame * 3) >> 3;
+      }
+      out[i] = (uint8_t)sum;
+    }
+  }
+};
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_each_pixel_exactly_once(void) {
+  startForkJoinWorker();
+  for (uint16_t count : { (uint16_t)0, (uint16_t)1, (uint16_t)63, (uint16_t)64, (uint16_t)65, (uint16_t)1000, (uint16_t)1628 }) {
+    std::vector<uint8_t> visits(count, 0);
+    auto kernel = [&](uint16_t first, uint16_t last) {
+      for (uint16_t i = first; i < last; i++) {
+        visits[i]++;
+      }
+    };
+    forEachPixelRange(count, kernel);
+    for (uint16_t i = 0; i < count; i++) {
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(1, visits[i], "pixel visited other than once");
+    }
+  }
+}
+
+void test_upper_half_runs_on_the_worker(void) {
+  startForkJoinWorker();
+  const std::thread::id caller = std::this_thread::get_id();
+  std::vector<bool> onWorker(PIXELS, false);
+  auto kernel = [&](uint16_t first, uint16_t last) {
+    for (uint16_t i = first; i < last; i++) {
+      onWorker[i] = (std::this_thread::get_id() != caller);
+    }
+  };
+  forEachPixelRange(PIXELS, kernel);
+  TEST_ASSERT_FALSE(onWorker[0]);
+  TEST_ASSERT_FALSE(onWorker[PIXELS / 2 - 1]);
+  TEST_ASSERT_TRUE(onWorker[PIXELS / 2]);
+  TEST_ASSERT_TRUE(onWorker[PIXELS - 1]);
+}
+
+void test_same_result_as_one_range(void) {
+  startForkJoinWorker();
+  uint8_t single[PIXELS], split[PIXELS];
+  for (uint16_t frame = 0; frame < 50; frame++) {
+    NoiseFrame one = { single, frame };
+    one(0, PIXELS);
+    NoiseFrame two = { split, frame };
+    forEachPixelRange(PIXELS, two);
+    TEST_ASSERT_EQUAL_MEMORY(single, split, PIXELS);
+  }
+}
+
+void test_benchmark_speedup(void) {
+  startForkJoinWorker();
+  static const uint16_t FRAMES = 3000;
+  static uint8_t out[PIXELS];
+  typedef std::chrono::steady_clock Clock;
+
+  const Clock::time_point singleStart = Clock::now();
+  for (uint16_t frame = 0; frame < FRAMES; frame++) {
+    NoiseFrame kernel = { out, frame };
+    kernel(0, PIXELS);
+  }
+  const double singleMicros = std::chrono::duration<double, std::micro>(Clock::now() - singleStart).count() / FRAMES;
+
+  const Clock::time_point splitStart = Clock::now();
+  for (uint16_t frame = 0; frame < FRAMES; frame++) {
+    NoiseFrame kernel = { out, frame };
+    forEachPixelRange(PIXELS, kernel);
+  }
+  const double splitMicros = std::chrono::duration<double, std::micro>(Clock::now() - splitStart).count() / FRAMES;
+
+  // the fixed cost of one fork and join, with nothing to do
+  auto empty = [](uint16_t, uint16_t) {};
+  const Clock::time_point emptyStart = Clock::now();
+  for (uint16_t frame = 0; frame < FRAMES; frame++) {
+    forEachPixelRange(PIXELS, empty);
+  }
+  const double overheadMicros = std::chrono::duration<double, std::micro>(Clock::now() - emptyStart).count() / FRAMES;
+
+  char message[200];
+  snprintf(message, sizeof(message), "%u pixels: one thread %.1f us/frame, two threads %.1f us/frame, speedup %.2fx; fork/join overhead %.1f us (%u hardware threads)",
+           (unsigned)PIXELS, singleMicros, splitMicros, singleMicros / splitMicros, overheadMicros, std::thread::hardware_concurrency());
+  TEST_MESSAGE(message);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_each_pixel_exactly_once);
+  RUN_TEST(test_upper_half_runs_on_the_worker);
+  RUN_TEST(test_same_result_as_one_range);
+  RUN_TEST(test_benchmark_speedup);
+  return UNITY_END();
+}
@@ -0,0 +1,190 @@
+// heatMap() (HeatMap.cpp, fire and water) against the Fire2012WithPalette version it
+// replaced: the packed cooling and the divide by three are exact, the flames look the
+// same on average, and the host time per pixel of both.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_PIXELS 1024 // Fibonacci1024
+#include "../../esp8266-fastled-webserver/HeatMap.cpp"
+
+CRGB leds[NUM_PIXELS];
+uint8_t cooling = 49;  // the sketch's defaults
+uint8_t sparking = 60;
+
+// heatMap() before the packed version, unchanged
+void heatMapBaseline(const CRGBPalette16& palette, bool up)
+{
+  fill_solid(leds, NUM_PIXELS, CRGB::Black);
+
+  // Modify random number generator seed; we use a lot of it.  (Note: this is still deterministic)
+  random16_add_entropy(random(256));
+
+  // Array of temperature readings at each simulation cell
+  static byte heat[NUM_PIXELS];
+
+  byte colorindex;
+
+  // Step 1.  Cool down every cell a little
+  for ( uint16_t i = 0; i < NUM_PIXELS; i++) {
+    heat[i] = qsub8( heat[i],  random8(0, ((cooling * 10) / NUM_PIXELS) + 2));
+  }
+
+  // Step 2.  Heat from each cell drifts 'up' and diffuses a little
+  for ( uint16_t k = NUM_PIXELS - 1; k >= 2; k--) {
+    heat[k] = (heat[k - 1] + heat[k - 2] + heat[k - 2] ) / 3;
+  }
+
+  // Step 3.  Randomly ignite new 'sparks' of heat near the bottom
+  if ( random8() < sparking ) {
+    int y = random8(7);
+    heat[y] = qadd8( heat[y], random8(160, 255) );
+  }
+
+  // Step 4.  Map from heat cells to LED colors
+  for ( uint16_t j = 0; j < NUM_PIXELS; j++) {
+    // Scale the heat value from 0-255 down to 0-240
+    // for best results with color palettes.
+    colorindex = scale8(heat[j], 190);
+
+    CRGB color = ColorFromPalette(palette, colorindex);
+
+    if (up) {
+      leds[j] = color;
+    }
+    else {
+      leds[(NUM_PIXELS - 1) - j] = color;
+    }
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_packed_cooling_is_exact(void) {
+  // every heat, random byte and limit, in each of the four lanes
+  for (uint16_t limit = 0; limit < 256; limit++) {
+    for (uint16_t heat = 0; heat < 256; heat++) {
+      for (uint16_t random = 0; random < 256; random++) {
+        const uint8_t lane = (heat + random) & 3;
+        const uint32_t heatWord = 0xA55A3CC3u ^ ((uint32_t)(heat ^ 0xA5) << (8 * lane)) ^ (0xA5u << (8 * lane));
+        const uint32_t randomWord = (0x5AC3A53Cu & ~(0xFFu << (8 * lane))) | ((uint32_t)random << (8 * lane));
+        const uint32_t cooled = coolHeatCells(heatWord, randomWord, limit);
+        for (uint8_t i = 0; i < 4; i++) {
+          const uint8_t h = heatWord >> (8 * i), r = randomWord >> (8 * i);
+          if ((uint8_t)(cooled >> (8 * i)) != qsub8(h, (r * limit) >> 8)) {
+            char message[64];
+            snprintf(message, sizeof(message), "heat %u, random %u, limit %u", h, r, (unsigned)limit);
+            TEST_FAIL_MESSAGE(message);
+            return;
+          }
+        }
+      }
+    }
+  }
+}
+
+void test_divide_by_three_is_exact(void) {
+  for (uint16_t sum = 0; sum <= 3 * 255; sum++) {
+    TEST_ASSERT_EQUAL_UINT16(sum / 3, (sum * 683) >> 11);
+  }
+}
+
+// Mean light of all pixels, and of the bottom 64 (the flames), over many frames
+struct FlameStatistics {
+  double meanLight;
+  double meanBottomLight;
+};
+
+template <typename HeatMap>
+static FlameStatistics flameStatistics(HeatMap heatMapFunction) {
+  static const uint32_t WARMUP = 500, FRAMES = 20000;
+  const CRGBPalette16 palette(HeatColors_p);
+  double light = 0, bottomLight = 0;
+  for (uint32_t frame = 0; frame < WARMUP + FRAMES; frame++) {
+    heatMapFunction(palette, true);
+    if (frame < WARMUP) continue;
+    for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+      const uint16_t sum = leds[i].r + leds[i].g + leds[i].b;
+      light += sum;
+      if (i < 64) bottomLight += sum;
+    }
+  }
+  FlameStatistics result;
+  result.meanLight = light / FRAMES / NUM_PIXELS;
+  result.meanBottomLight = bottomLight / FRAMES / 64;
+  return result;
+}
+
+// The random bytes for cooling come from another generator, so frames differ;
+// averaged over many frames, the flames are as tall and as bright as before.
+void test_flames_match_baseline_on_average(void) {
+  const FlameStatistics baseline = flameStatistics(heatMapBaseline);
+  const FlameStatistics packed = flameStatistics(heatMap);
+  char message[128];
+  snprintf(message, sizeof(message), "mean light: baseline %.2f, packed %.2f; bottom 64 pixels: baseline %.2f, packed %.2f",
+           baseline.meanLight, packed.meanLight, baseline.meanBottomLight, packed.meanBottomLight);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_FLOAT_WITHIN(baseline.meanBottomLight * 0.05f, baseline.meanBottomLight, packed.meanBottomLight);
+  TEST_ASSERT_FLOAT_WITHIN(baseline.meanLight * 0.10f + 0.05f, baseline.meanLight, packed.meanLight);
+}
+
+template <typename Frame>
+static double nanosPerPixel(Frame frameFunction) {
+  static const int FRAMES = 2000;
+  double best = 1e9;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+      frameFunction(frame);
+    }
+    const double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (nanos < best) best = nanos;
+  }
+  return best / FRAMES / NUM_PIXELS;
+}
+
+static void report(const char* name, double baseline, double packed) {
+  char message[128];
+  snprintf(message, sizeof(message), "%-8s %u pixels: baseline %.2f ns/pixel, packed %.2f ns/pixel, %.2fx",
+           name, (unsigned)NUM_PIXELS, baseline, packed, baseline / packed);
+  TEST_MESSAGE(message);
+}
+
+// Host numbers only guard against a regression: FastLED's random8() and the
+// divide are far cheaper relative to the rest on x86-64 than on the Xtensa cores.
+void test_benchmark_host_time_per_pixel(void) {
+  const CRGBPalette16 palette(HeatColors_p);
+  alignas(4) static byte heat[heatCellCount];
+  const uint8_t limit = ((cooling * 10) / NUM_PIXELS) + 2;
+
+  // Step 1 alone: random8() and qsub8() per cell, against coolHeatCells() per word
+  const double coolBaseline = nanosPerPixel([&](int) {
+    for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+      heat[i] = qsub8(heat[i], random8(0, limit));
+    }
+  });
+  const double coolPacked = nanosPerPixel([&](int) {
+    packed_word_t* words = reinterpret_cast<packed_word_t*>(heat);
+    for (uint16_t w = 0; w < (heatCellCount / 4); w++) {
+      words[w] = coolHeatCells(words[w], heatRandom32(), limit);
+    }
+  });
+  report("cooling", coolBaseline, coolPacked);
+
+  // The whole frame, which ColorFromPalette() dominates on the host
+  const double frameBaseline = nanosPerPixel([&](int frame) { heatMapBaseline(palette, (frame & 1) != 0); });
+  const double framePacked = nanosPerPixel([&](int frame) { heatMap(palette, (frame & 1) != 0); });
+  report("frame", frameBaseline, framePacked);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_packed_cooling_is_exact);
+  RUN_TEST(test_divide_by_three_is_exact);
+  RUN_TEST(test_flames_match_baseline_on_average);
+  RUN_TEST(test_benchmark_host_time_per_pixel);
+  return UNITY_END();
+}
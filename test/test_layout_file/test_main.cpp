@@ -0,0 +1,230 @@
+// Loading /layout.bin (LayoutFile.cpp): a file that is truncated, of another
+// size, format or pixel count, or whose Fibonacci tables are not each other's
+// inverse is refused, keeping the built-in maps; a good one replaces them.  And
+// what scripts/layout-tool.py builds from a CSV loads with the CSV's values.
+
+#include <unity.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#define NUM_PIXELS 1024 // Fibonacci1024, so the Fibonacci tables are uint16_t
+#define IS_FIBONACCI 1
+#define HAS_COORDINATE_MAP 1
+#define RUNTIME_LAYOUT_FILE 1
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/include/LayoutFile.hpp"
+#include "../../esp8266-fastled-webserver/LayoutFile.cpp"
+
+// The built-in maps: zeros, and the identity order
+static uint8_t builtInCoordinates[NUM_PIXELS] __attribute__((aligned(4)));
+static fibonacci_index_t builtInOrder[NUM_PIXELS] __attribute__((aligned(4)));
+MapTable<uint8_t> coordsX(builtInCoordinates);
+MapTable<uint8_t> coordsY(builtInCoordinates);
+MapTable<uint8_t> angles(builtInCoordinates);
+MapTable<uint8_t> radiusProxy(builtInCoordinates);
+MapTable<fibonacci_index_t> physicalToFibonacci(builtInOrder);
+MapTable<fibonacci_index_t> fibonacciToPhysical(builtInOrder);
+
+// The values of the test layout, for pixel i
+static uint8_t x(uint16_t i)      { return i % 256; }
+static uint8_t y(uint16_t i)      { return (i * 3) % 256; }
+static uint8_t angle(uint16_t i)  { return (i * 5) % 256; }
+static uint8_t radius(uint16_t i) { return (i / 4) % 256; }
+static uint16_t spiral(uint16_t i) { return (i * 7) % NUM_PIXELS; } // physicalToFibonacci; 7 is coprime with NUM_PIXELS
+
+static void append(std::string& file, const void* data, size_t bytes) {
+  file.append(static_cast<const char*>(data), bytes);
+  file.append(-bytes & 3, '\0');
+}
+
+// A layout file, as LayoutFile.hpp describes it, with two neighbors per pixel and 16 rings
+static std::string goodFile() {
+  const LayoutFileHeader header = { { 'L', 'A', 'Y', 'T' }, LAYOUT_FILE_VERSION,
+                                    LAYOUT_HAS_FIBONACCI | LAYOUT_HAS_NEIGHBORS | LAYOUT_HAS_RINGS, 2, 0, NUM_PIXELS, 16 };
+  std::string file(reinterpret_cast<const char*>(&header), sizeof(header));
+  uint8_t bytes[4][NUM_PIXELS];
+  uint16_t order[2][NUM_PIXELS];
+  uint16_t neighbors[NUM_PIXELS][2];
+  uint16_t rings[16][2];
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    bytes[0][i] = x(i); bytes[1][i] = y(i); bytes[2][i] = angle(i); bytes[3][i] = radius(i);
+    order[0][i] = spiral(i);
+    order[1][spiral(i)] = i;
+    // listed in order, then padded with 0xFFFF
+    neighbors[i][0] = (i > 0) ? i - 1 : i + 1;
+    neighbors[i][1] = ((i > 0) && (i < NUM_PIXELS - 1)) ? i + 1 : 0xFFFF;
+  }
+  for (uint16_t ring = 0; ring < 16; ring++) {
+    rings[ring][0] = ring * 64;
+    rings[ring][1] = ring * 64 + 63;
+  }
+  for (int table = 0; table < 4; table++) append(file, bytes[table], NUM_PIXELS);
+  for (int table = 0; table < 2; table++) append(file, order[table], sizeof(order[table]));
+  append(file, neighbors, sizeof(neighbors));
+  append(file, rings, sizeof(rings));
+  return file;
+}
+
+// readLayoutFile()'s verdict on a file with this content
+static const char* verdict(const std::string& content) {
+  LittleFS.files["/test.bin"].content = content;
+  File file = LittleFS.open("/test.bin", "r");
+  uint8_t* tables = nullptr;
+  const char* error = readLayoutFile(file, tables);
+  file.close();
+  free(tables);
+  return error;
+}
+
+static void assertRefused(const std::string& content, const char* expected) {
+  const char* error = verdict(content);
+  TEST_ASSERT_NOT_NULL(error);
+  TEST_ASSERT_EQUAL_STRING(expected, error);
+}
+
+// Whether the maps in use hold the test layout
+static bool testLayoutInUse() {
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    if ((coordsX[i] != x(i)) || (coordsY[i] != y(i)) || (angles[i] != angle(i)) || (radiusProxy[i] != radius(i)) ||
+        (physicalToFibonacci[i] != spiral(i)) || (fibonacciToPhysical[spiral(i)] != i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void setUp(void) {
+  LittleFS.files.clear();
+}
+void tearDown(void) {}
+
+void test_good_file_accepted(void) {
+  TEST_ASSERT_NULL(verdict(goodFile()));
+}
+
+void test_truncated_header_refused(void) {
+  assertRefused(std::string(), "truncated header");
+  assertRefused(goodFile().substr(0, sizeof(LayoutFileHeader) - 1), "truncated header");
+}
+
+void test_wrong_header_refused(void) {
+  std::string file = goodFile();
+  file[0] = 'X';
+  assertRefused(file, "not a layout file");
+
+  file = goodFile();
+  file[offsetof(LayoutFileHeader, version)] = LAYOUT_FILE_VERSION + 1;
+  assertRefused(file, "unsupported version");
+
+  file = goodFile();
+  file[offsetof(LayoutFileHeader, pixelCount) + 1] = 3; // 768 pixels
+  assertRefused(file, "pixel count does not match NUM_PIXELS");
+
+  file = goodFile();
+  file[offsetof(LayoutFileHeader, flags)] &= ~LAYOUT_HAS_FIBONACCI;
+  assertRefused(file, "no Fibonacci order, which this product's patterns require");
+}
+
+void test_wrong_size_refused(void) {
+  const std::string file = goodFile();
+  assertRefused(file + '\0', "file size does not match header");
+  assertRefused(file.substr(0, file.size() - 4), "file size does not match header");
+  assertRefused(file.substr(0, sizeof(LayoutFileHeader) + 100), "file size does not match header");
+
+  std::string moreRings = file;
+  moreRings[offsetof(LayoutFileHeader, ringCount)] = 17;
+  assertRefused(moreRings, "file size does not match header");
+}
+
+void test_non_inverse_fibonacci_tables_refused(void) {
+  const size_t toFibonacci = sizeof(LayoutFileHeader) + 4 * NUM_PIXELS;
+  const size_t toPhysical = toFibonacci + NUM_PIXELS * sizeof(uint16_t);
+
+  // two entries of one table swapped: both are still permutations
+  std::string file = goodFile();
+  std::swap(file[toPhysical], file[toPhysical + 2]);
+  std::swap(file[toPhysical + 1], file[toPhysical + 3]);
+  assertRefused(file, "Fibonacci tables are not inverse permutations");
+
+  // an index past the end of leds[]
+  file = goodFile();
+  file[toFibonacci + 1] = (char)0x04; // 1024 + the low byte
+  assertRefused(file, "Fibonacci tables are not inverse permutations");
+}
+
+// A refused file keeps the built-in maps; a good one replaces them, once
+void test_load_replaces_maps_only_when_valid(void) {
+  std::string file = goodFile();
+  file[0] = 'X';
+  LittleFS.files[LAYOUT_FILE_PATH].content = file;
+  TEST_ASSERT_FALSE(loadLayoutFile());
+  TEST_ASSERT_FALSE(layoutFileLoaded());
+  TEST_ASSERT_TRUE(coordsX[1] == 0 && physicalToFibonacci[1] == 0);
+
+  LittleFS.files[LAYOUT_FILE_PATH].content = goodFile();
+  TEST_ASSERT_TRUE(loadLayoutFile());
+  TEST_ASSERT_TRUE(layoutFileLoaded());
+  TEST_ASSERT_TRUE(testLayoutInUse());
+}
+
+static std::string readHostFile(const std::string& path) {
+  std::string content;
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file != nullptr) {
+    char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) content.append(buffer, count);
+    fclose(file);
+  }
+  return content;
+}
+
+// layout-tool.py builds the same file from the test layout as a CSV
+void test_layout_tool_output_round_trips(void) {
+  std::string script = __FILE__;
+  script = script.substr(0, script.rfind('/') + 1) + "../../scripts/layout-tool.py";
+  char directory[] = "/tmp/layout-test-XXXXXX";
+  TEST_ASSERT_NOT_NULL(mkdtemp(directory));
+  const std::string csvPath = std::string(directory) + "/layout.csv";
+  const std::string binPath = std::string(directory) + "/layout.bin";
+
+  FILE* csv = fopen(csvPath.c_str(), "w");
+  fprintf(csv, "x,y,angle,radius,fibonacci,neighbors,ring\n");
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    fprintf(csv, "%u,%u,%u,%u,%u,", x(i), y(i), angle(i), radius(i), spiral(i));
+    if (i > 0) fprintf(csv, "%u", i - 1);
+    if (i < NUM_PIXELS - 1) fprintf(csv, "%s%u", (i > 0) ? " " : "", i + 1);
+    fprintf(csv, ",%u\n", i / 64);
+  }
+  fclose(csv);
+
+  const std::string command = "python3 " + script + " build " + csvPath + " -o " + binPath + " --no-scale > /dev/null";
+  const int status = system(command.c_str());
+  const std::string built = readHostFile(binPath);
+  remove(csvPath.c_str());
+  remove(binPath.c_str());
+  rmdir(directory);
+  if (WEXITSTATUS(status) == 127) {
+    TEST_IGNORE_MESSAGE("python3 not found");
+  }
+  TEST_ASSERT_EQUAL_INT(0, status);
+  TEST_ASSERT_EQUAL_UINT32(goodFile().size(), built.size());
+  TEST_ASSERT_TRUE(built == goodFile());
+  TEST_ASSERT_NULL(verdict(built));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_good_file_accepted);
+  RUN_TEST(test_truncated_header_refused);
+  RUN_TEST(test_wrong_header_refused);
+  RUN_TEST(test_wrong_size_refused);
+  RUN_TEST(test_non_inverse_fibonacci_tables_refused);
+  RUN_TEST(test_load_replaces_maps_only_when_valid);
+  RUN_TEST(test_layout_tool_output_round_trips);
+  return UNITY_END();
+}
@@ -0,0 +1,103 @@
+// The log ring buffer (Log.cpp): logDrain() writes at most LOG_DRAIN_MAX_BYTES, and
+// no more than the UART takes, per call; one call per loop keeps up with a steady
+// stream of messages with no sleeping between frames; and lines overwritten before
+// they were drained or copied are skipped whole.
+
+#include <unity.h>
+
+#include <stdio.h>
+
+#define LOG_LEVEL LOG_LEVEL_DEBUG
+#define LOG_BUFFER_SIZE 512 // as on ESP8266
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/Log.cpp"
+
+// Everything logged so far reaches Serial, and the next test starts from empty
+static void drainAll() {
+  for (int i = 0; i < 1000; i++) {
+    Serial.fifoFree = LOG_DRAIN_MAX_BYTES;
+    logDrain();
+  }
+  Serial.written.clear();
+}
+
+void setUp(void) {
+  hostMillis() = 1000;
+  drainAll();
+}
+void tearDown(void) {}
+
+void test_drain_is_bounded(void) {
+  for (int i = 0; i < 8; i++) {
+    LOG_INFO("message %d, long enough that a few of them fill more than one drain", i);
+  }
+  Serial.fifoFree = 4096; // more room than any UART has
+  logDrain();
+  TEST_ASSERT_EQUAL_UINT32(LOG_DRAIN_MAX_BYTES, Serial.written.size());
+
+  Serial.fifoFree = 10;
+  logDrain();
+  TEST_ASSERT_EQUAL_UINT32(LOG_DRAIN_MAX_BYTES + 10, Serial.written.size());
+
+  Serial.fifoFree = 0;
+  logDrain();
+  TEST_ASSERT_EQUAL_UINT32(LOG_DRAIN_MAX_BYTES + 10, Serial.written.size());
+}
+
+// At 115200 baud, the UART sends about 190 bytes per 16 ms frame, emptying its
+// 128 byte FIFO.  With a line logged every frame, and logDrain() once per loop,
+// nothing is lost.
+void test_one_drain_per_loop_keeps_up(void) {
+  std::string expected;
+  for (uint32_t frame = 0; frame < 2000; frame++) {
+    hostMillis() += 16;
+    LOG_INFO("frame %u took %u ms, request for /js/app.js", (unsigned)frame, (unsigned)(frame % 40));
+    char line[LOG_MESSAGE_MAX];
+    snprintf(line, sizeof(line), "%lu I frame %u took %u ms, request for /js/app.js\n",
+             (unsigned long)hostMillis(), (unsigned)frame, (unsigned)(frame % 40));
+    expected += line;
+    Serial.fifoFree = 128;
+    logDrain();
+  }
+  for (int i = 0; i < 10; i++) {
+    Serial.fifoFree = 128;
+    logDrain();
+  }
+  TEST_ASSERT_TRUE(Serial.written == expected);
+}
+
+void test_overwritten_lines_are_skipped_whole(void) {
+  String before;
+  const uint32_t start = logCopy(0, before);
+  for (int i = 0; i < 40; i++) {
+    LOG_WARN("line %02d", i);
+  }
+  drainAll(); // clears what was drained
+  for (int i = 0; i < 100; i++) {
+    LOG_WARN("line %02d of a burst that overflows the buffer before it is drained", i);
+  }
+  Serial.fifoFree = 100000;
+  for (int i = 0; i < 20; i++) {
+    logDrain();
+  }
+  const std::string& written = Serial.written;
+  TEST_ASSERT_TRUE(written.size() <= LOG_BUFFER_SIZE);
+  TEST_ASSERT_TRUE(written.compare(0, 5, "1000 ") == 0); // a whole line, from its timestamp
+  TEST_ASSERT_TRUE(written.find("line 99 of a burst") != std::string::npos);
+
+  String copy;
+  const uint32_t end = logCopy(start, copy);
+  TEST_ASSERT_TRUE(copy.startsWith("1000 W line "));
+  TEST_ASSERT_TRUE(copy.endsWith("line 99 of a burst that overflows the buffer before it is drained\n"));
+  String none;
+  TEST_ASSERT_EQUAL_UINT32(end, logCopy(end, none));
+  TEST_ASSERT_EQUAL_UINT32(0, none.length());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_drain_is_bounded);
+  RUN_TEST(test_one_drain_per_loop_keeps_up);
+  RUN_TEST(test_overwritten_lines_are_skipped_whole);
+  return UNITY_END();
+}
@@ -0,0 +1,84 @@
+// MapTableStream (include/MapTable.hpp) against indexing the same MapTable, for
+// every start offset, with uint8_t and uint16_t entries, at table lengths that
+// end on a whole word and at each partial one: a start in every lane of a word,
+// and the entries after WHOLE_WORD_ENTRIES, which are read one at a time.
+//
+// Each table ends at the end of a page followed by an inaccessible one, so
+// reading a word past the table's end stops the test.
+
+#include <unity.h>
+
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../../esp8266-fastled-webserver/common.h"
+
+// A table of count entries, ending where the readable memory does
+template <typename T>
+class GuardedTable {
+public:
+  explicit GuardedTable(uint16_t count) {
+    const size_t page = sysconf(_SC_PAGESIZE);
+    const size_t bytes = (count * sizeof(T) + 3) & ~(size_t)3;
+    _length = ((bytes + page - 1) / page + 1) * page;
+    _memory = static_cast<uint8_t*>(mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    mprotect(_memory + _length - page, page, PROT_NONE);
+    _entries = reinterpret_cast<T*>(_memory + _length - page - bytes);
+    for (uint16_t i = 0; i < count; i++) {
+      _entries[i] = static_cast<T>(i * 40503u + 17); // distinct in every byte
+    }
+  }
+  ~GuardedTable() { munmap(_memory, _length); }
+  const T* entries() const { return _entries; }
+private:
+  uint8_t* _memory;
+  size_t _length;
+  T* _entries;
+};
+
+template <typename T, uint16_t ENTRIES>
+static void checkEveryStart() {
+  GuardedTable<T> guarded(ENTRIES);
+  const MapTable<T> table(guarded.entries());
+  uint32_t compared = 0;
+  for (uint16_t first = 0; first < ENTRIES; first++) {
+    MapTableStream<T, ENTRIES> stream(table, first);
+    for (uint16_t i = first; i < ENTRIES; i++) {
+      const T streamed = stream.next();
+      if (streamed != table[i]) {
+        char message[96];
+        snprintf(message, sizeof(message), "%u-byte entries, %u of them: from %u, entry %u streamed %u, indexed %u",
+                 (unsigned)sizeof(T), (unsigned)ENTRIES, (unsigned)first, (unsigned)i, (unsigned)streamed, (unsigned)table[i]);
+        TEST_FAIL_MESSAGE(message);
+      }
+      compared++;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)ENTRIES * (ENTRIES + 1) / 2, compared);
+}
+
+template <uint16_t ENTRIES>
+static void checkBothWidths() {
+  checkEveryStart<uint8_t, ENTRIES>();
+  checkEveryStart<uint16_t, ENTRIES>();
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_34_entries(void)   { checkBothWidths<34>(); }   // Fibonacci32's 34 pixels: two past a whole word
+void test_1024_entries(void) { checkBothWidths<1024>(); } // whole words only
+void test_1026_entries(void) { checkBothWidths<1026>(); }
+void test_1027_entries(void) { checkBothWidths<1027>(); }
+void test_1628_entries(void) { checkBothWidths<1628>(); } // the 1628-ring disc
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_34_entries);
+  RUN_TEST(test_1024_entries);
+  RUN_TEST(test_1026_entries);
+  RUN_TEST(test_1027_entries);
+  RUN_TEST(test_1628_entries);
+  return UNITY_END();
+}
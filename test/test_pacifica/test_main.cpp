@@ -0,0 +1,261 @@
+// Pacifica (Pacifica.cpp), which renders each pixel in one pass, against the three-pass
+// version it replaced: bit-for-bit the same frames, in linear and Fibonacci order, and
+// the host time per pixel of both.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_PIXELS 1024 // Fibonacci1024, with its defaults
+#define IS_FIBONACCI 1
+#define LOGICAL_RENDER_BUFFER 1
+#include "../../esp8266-fastled-webserver/PixelOrder.cpp"
+
+CRGB leds[NUM_PIXELS];
+
+// Any permutation will do; this one is fixed by the seed
+alignas(4) static uint16_t fibonacciToPhysical_p[NUM_PIXELS];
+MapTable<fibonacci_index_t> fibonacciToPhysical(fibonacciToPhysical_p);
+
+namespace single_pass {
+  #include "../../esp8266-fastled-webserver/Pacifica.cpp"
+}
+
+// Pacifica before the single pass, unchanged
+namespace baseline {
+  CRGBPalette16 pacifica_palette_1 = 
+      { 0x000507, 0x000409, 0x00030B, 0x00030D, 0x000210, 0x000212, 0x000114, 0x000117, 
+        0x000019, 0x00001C, 0x000026, 0x000031, 0x00003B, 0x000046, 0x14554B, 0x28AA50 };
+  CRGBPalette16 pacifica_palette_2 = 
+      { 0x000507, 0x000409, 0x00030B, 0x00030D, 0x000210, 0x000212, 0x000114, 0x000117, 
+        0x000019, 0x00001C, 0x000026, 0x000031, 0x00003B, 0x000046, 0x0C5F52, 0x19BE5F };
+  CRGBPalette16 pacifica_palette_3 = 
+      { 0x000208, 0x00030E, 0x000514, 0x00061A, 0x000820, 0x000927, 0x000B2D, 0x000C33, 
+        0x000E39, 0x001040, 0x001450, 0x001860, 0x001C70, 0x002080, 0x1040BF, 0x2060FF };
+
+  // Add one layer of waves into the led array
+  void pacifica_one_layer( CRGBPalette16& p, uint16_t cistart, uint16_t wavescale, uint8_t bri, uint16_t ioff, bool useFibonacciOrder)
+  {
+    uint16_t ci = cistart;
+    uint16_t waveangle = ioff;
+    uint16_t wavescale_half = (wavescale / 2) + 20;
+    for( uint16_t i = 0; i < NUM_PIXELS; i++) {
+      waveangle += 250;
+      uint16_t s16 = sin16( waveangle ) + 32768;
+      uint16_t cs = scale16( s16 , wavescale_half ) + wavescale_half;
+      ci += cs;
+      uint16_t sindex16 = sin16( ci) + 32768;
+      uint8_t sindex8 = scale16( sindex16, 240);
+      CRGB c = ColorFromPalette( p, sindex8, bri, LINEARBLEND);
+  #if IS_FIBONACCI
+      uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
+  #else
+      (void)useFibonacciOrder; // unused parameter
+      uint16_t idx = i;
+  #endif
+      leds[idx] += c;
+    }
+  }
+
+  // Add extra 'white' to areas where the four layers of light have lined up brightly
+  void pacifica_add_whitecaps(bool useFibonacciOrder)
+  {
+    uint8_t basethreshold = beatsin8( 9, 55, 65);
+    uint8_t wave = beat8( 7 );
+
+    for( uint16_t i = 0; i < NUM_PIXELS; i++) {
+  #if IS_FIBONACCI
+      uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
+  #else
+      (void)useFibonacciOrder; // unused parameter
+      uint16_t idx = i;
+  #endif
+
+      uint8_t threshold = scale8( sin8( wave), 20) + basethreshold;
+      wave += 7;
+      uint8_t l = leds[idx].getAverageLight();
+      if( l > threshold) {
+        uint8_t overage = l - threshold;
+        uint8_t overage2 = qadd8( overage, overage);
+        leds[idx] += CRGB( overage, overage2, qadd8( overage2, overage2));
+      }
+    }
+  }
+
+  // Deepen the blues and greens
+  void pacifica_deepen_colors(bool useFibonacciOrder)
+  {
+    for( uint16_t i = 0; i < NUM_PIXELS; i++) {
+  #if IS_FIBONACCI
+      uint16_t idx = useFibonacciOrder ? fibonacciToPhysical[i] : i;
+  #else
+      (void)useFibonacciOrder; // unused parameter
+      uint16_t idx = i;
+  #endif
+
+      leds[idx].blue = scale8( leds[idx].blue,  145); 
+      leds[idx].green= scale8( leds[idx].green, 200); 
+      leds[idx] |= CRGB( 2, 5, 7);
+    }
+  }
+
+  void pacifica_loop_impl(bool useFibonacciOrder)
+  {
+    // Increment the four "color index start" counters, one for each wave layer.
+    // Each is incremented at a different speed, and the speeds vary over time.
+    static uint16_t sCIStart1, sCIStart2, sCIStart3, sCIStart4;
+    static uint32_t sLastms = 0;
+    uint32_t ms = GET_MILLIS();
+    uint32_t deltams = ms - sLastms;
+    sLastms = ms;
+    uint16_t speedfactor1 = beatsin16(3, 179, 269);
+    uint16_t speedfactor2 = beatsin16(4, 179, 269);
+    uint32_t deltams1 = (deltams * speedfactor1) / 256;
+    uint32_t deltams2 = (deltams * speedfactor2) / 256;
+    uint32_t deltams21 = (deltams1 + deltams2) / 2;
+    sCIStart1 += (deltams1 * beatsin88(1011,10,13));
+    sCIStart2 -= (deltams21 * beatsin88(777,8,11));
+    sCIStart3 -= (deltams1 * beatsin88(501,5,7));
+    sCIStart4 -= (deltams2 * beatsin88(257,4,6));
+
+    // Clear out the LED array to a dim background blue-green
+    fill_solid( leds, NUM_PIXELS, CRGB( 2, 6, 10));
+
+    // Render each of four layers, with different scales and speeds, that vary over time
+    pacifica_one_layer( pacifica_palette_1, sCIStart1, beatsin16( 3, 11 * 256, 14 * 256), beatsin8( 10, 70, 130), 0-beat16( 301), useFibonacciOrder );
+    pacifica_one_layer( pacifica_palette_2, sCIStart2, beatsin16( 4,  6 * 256,  9 * 256), beatsin8( 17, 40,  80), beat16( 401),   useFibonacciOrder );
+    pacifica_one_layer( pacifica_palette_3, sCIStart3, 6 * 256,                           beatsin8(  9, 10,  38), 0-beat16(503),  useFibonacciOrder );
+    pacifica_one_layer( pacifica_palette_3, sCIStart4, 5 * 256,                           beatsin8(  8, 10,  28), beat16(601),    useFibonacciOrder );
+
+    // Add brighter 'whitecaps' where the waves lines up more
+    pacifica_add_whitecaps(useFibonacciOrder);
+
+    // Deepen the blues and greens a bit
+    pacifica_deepen_colors(useFibonacciOrder);
+  }
+
+  // TODO: Export only these two functions via header file
+  void pacifica_loop()
+  {
+    return pacifica_loop_impl(false);
+  }
+
+  #if IS_FIBONACCI
+  void pacifica_fibonacci_loop()
+  {
+    return pacifica_loop_impl(true);
+  }
+  #endif
+}
+
+static CRGB expected[NUM_PIXELS];
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void shuffleFibonacciToPhysical() {
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    fibonacciToPhysical_p[i] = i;
+  }
+  random16_set_seed(4321);
+  for (uint16_t i = NUM_PIXELS - 1; i > 0; i--) {
+    const uint16_t j = random16(i + 1);
+    const uint16_t swap = fibonacciToPhysical_p[i];
+    fibonacciToPhysical_p[i] = fibonacciToPhysical_p[j];
+    fibonacciToPhysical_p[j] = swap;
+  }
+}
+
+typedef void (*Pattern)();
+
+static void assertSameFrames(Pattern baselinePattern, Pattern singlePassPattern) {
+  // uneven frame times, including a long gap, as the energy governor produces
+  uint32_t ms = 123456;
+  for (uint32_t frame = 0; frame < 3000; frame++) {
+    ms += (frame % 97 == 0) ? 1500 : 8 + (frame % 13);
+    hostMillis() = ms;
+    baselinePattern();
+    memcpy(expected, leds, sizeof(leds));
+    singlePassPattern();
+    outputLogicalPixels();
+    if (memcmp(expected, leds, sizeof(leds)) != 0) {
+      char message[48];
+      snprintf(message, sizeof(message), "frame %u differs", (unsigned)frame);
+      TEST_FAIL_MESSAGE(message);
+      return;
+    }
+  }
+}
+
+void test_linear_same_frames_as_baseline(void) {
+  assertSameFrames(baseline::pacifica_loop, single_pass::pacifica_loop);
+}
+
+void test_fibonacci_same_frames_as_baseline(void) {
+  shuffleFibonacciToPhysical();
+  assertSameFrames(baseline::pacifica_fibonacci_loop, single_pass::pacifica_fibonacci_loop);
+}
+
+// The two patterns share the animation's state, so switching between them continues it
+void test_alternating_orders_same_frames_as_baseline(void) {
+  shuffleFibonacciToPhysical();
+  uint32_t ms = 654321;
+  for (uint32_t frame = 0; frame < 3000; frame++) {
+    const bool fibonacci = ((frame / 50) % 2) != 0;
+    ms += (frame % 50 == 0) ? 5000 : 16;
+    hostMillis() = ms;
+    (fibonacci ? baseline::pacifica_fibonacci_loop : baseline::pacifica_loop)();
+    memcpy(expected, leds, sizeof(leds));
+    (fibonacci ? single_pass::pacifica_fibonacci_loop : single_pass::pacifica_loop)();
+    outputLogicalPixels();
+    if (memcmp(expected, leds, sizeof(leds)) != 0) {
+      char message[48];
+      snprintf(message, sizeof(message), "frame %u differs", (unsigned)frame);
+      TEST_FAIL_MESSAGE(message);
+      return;
+    }
+  }
+}
+
+static double nanosPerPixel(Pattern pattern, bool output) {
+  static const int FRAMES = 300;
+  double best = 1e9;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+      hostMillis() = 1000 + frame * 16;
+      pattern();
+      if (output) outputLogicalPixels();
+    }
+    const double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (nanos < best) best = nanos;
+  }
+  return best / FRAMES / NUM_PIXELS;
+}
+
+// Host numbers: the single pass saves the extra passes over leds[] (and, in Fibonacci
+// order, the scattered reads of fibonacciToPhysical[]), which cost more on Xtensa.
+void test_benchmark_host_time_per_pixel(void) {
+  shuffleFibonacciToPhysical();
+  const double linearBaseline = nanosPerPixel(baseline::pacifica_loop, false);
+  const double linearSinglePass = nanosPerPixel(single_pass::pacifica_loop, true);
+  const double fibonacciBaseline = nanosPerPixel(baseline::pacifica_fibonacci_loop, false);
+  const double fibonacciSinglePass = nanosPerPixel(single_pass::pacifica_fibonacci_loop, true);
+  char message[128];
+  snprintf(message, sizeof(message), "linear:    three passes %.2f ns/pixel, one pass %.2f ns/pixel, %.2fx",
+           linearBaseline, linearSinglePass, linearBaseline / linearSinglePass);
+  TEST_MESSAGE(message);
+  snprintf(message, sizeof(message), "fibonacci: three passes %.2f ns/pixel, one pass %.2f ns/pixel, %.2fx",
+           fibonacciBaseline, fibonacciSinglePass, fibonacciBaseline / fibonacciSinglePass);
+  TEST_MESSAGE(message);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_linear_same_frames_as_baseline);
+  RUN_TEST(test_fibonacci_same_frames_as_baseline);
+  RUN_TEST(test_alternating_orders_same_frames_as_baseline);
+  RUN_TEST(test_benchmark_host_time_per_pixel);
+  return UNITY_END();
+}
@@ -0,0 +1,124 @@
+// ParameterSnapshot: the lock-free handoff from the network task to the render task
+// (include/ParameterSnapshot.hpp), with the writer and reader on two std::threads.
+
+#include <unity.h>
+
+#include <atomic>
+#include <thread>
+
+#include "../../esp8266-fastled-webserver/include/ParameterSnapshot.hpp"
+
+// Every field derives from sequence, so a value mixing two publishes is detectable.
+struct Parameters {
+  uint32_t sequence;
+  uint32_t squared;
+  uint8_t bytes[24];
+};
+
+static Parameters parametersFor(uint32_t sequence) {
+  Parameters result;
+  result.sequence = sequence;
+  result.squared = sequence * sequence;
+  for (uint8_t i = 0; i < sizeof(result.bytes); i++) {
+    result.bytes[i] = (uint8_t)(sequence + i);
+  }
+  return result;
+}
+
+static bool consistent(const Parameters& value) {
+  if (value.squared != value.sequence * value.sequence) {
+    return false;
+  }
+  for (uint8_t i = 0; i < sizeof(value.bytes); i++) {
+    if (value.bytes[i] != (uint8_t)(value.sequence + i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_initial_value_until_first_publish(void) {
+  ParameterSnapshot<Parameters> snapshot(parametersFor(7));
+  TEST_ASSERT_EQUAL_UINT32(7, snapshot.acquire().sequence);
+  TEST_ASSERT_EQUAL_UINT32(7, snapshot.acquire().sequence);
+}
+
+void test_acquire_returns_latest_publish(void) {
+  ParameterSnapshot<Parameters> snapshot(parametersFor(0));
+  snapshot.publish(parametersFor(1));
+  snapshot.publish(parametersFor(2));
+  snapshot.publish(parametersFor(3));
+  TEST_ASSERT_EQUAL_UINT32(3, snapshot.acquire().sequence);
+  // nothing newer: the same value again
+  TEST_ASSERT_EQUAL_UINT32(3, snapshot.acquire().sequence);
+}
+
+void test_acquired_value_stable_until_next_acquire(void) {
+  ParameterSnapshot<Parameters> snapshot(parametersFor(0));
+  snapshot.publish(parametersFor(1));
+  const Parameters& frame = snapshot.acquire();
+  for (uint32_t i = 2; i < 10; i++) {
+    snapshot.publish(parametersFor(i)); // the writer cycles through the other two slots
+    TEST_ASSERT_EQUAL_UINT32(1, frame.sequence);
+    TEST_ASSERT_TRUE(consistent(frame));
+  }
+  TEST_ASSERT_EQUAL_UINT32(9, snapshot.acquire().sequence);
+}
+
+void test_threads_never_see_torn_or_older_values(void) {
+  static const uint32_t PUBLISHES = 2000000;
+  ParameterSnapshot<Parameters> snapshot(parametersFor(0));
+  std::atomic<bool> torn(false);
+  std::atomic<bool> wentBack(false);
+  uint32_t acquires = 0;
+  uint32_t distinct = 0;
+
+  std::thread reader([&]() {
+    uint32_t last = 0;
+    while (last != PUBLISHES) {
+      const Parameters& value = snapshot.acquire();
+      if (!consistent(value)) {
+        torn = true;
+        return;
+      }
+      if (value.sequence < last) {
+        wentBack = true;
+        return;
+      }
+      if (value.sequence != last) {
+        distinct++;
+      }
+      last = value.sequence;
+      acquires++;
+    }
+  });
+  std::thread writer([&]() {
+    for (uint32_t i = 1; i <= PUBLISHES; i++) {
+      snapshot.publish(parametersFor(i));
+      if ((i % 64) == 0) {
+        std::this_thread::yield(); // let the reader interleave, even on one CPU
+      }
+    }
+  });
+  writer.join();
+  reader.join();
+
+  TEST_ASSERT_FALSE(torn);
+  TEST_ASSERT_FALSE(wentBack);
+  TEST_ASSERT_EQUAL_UINT32(PUBLISHES, snapshot.acquire().sequence);
+  char message[96];
+  snprintf(message, sizeof(message), "%u acquires saw %u distinct values", (unsigned)acquires, (unsigned)distinct);
+  TEST_MESSAGE(message);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_initial_value_until_first_publish);
+  RUN_TEST(test_acquire_returns_latest_publish);
+  RUN_TEST(test_acquired_value_stable_until_next_acquire);
+  RUN_TEST(test_threads_never_see_torn_or_older_values);
+  return UNITY_END();
+}
@@ -0,0 +1,181 @@
+// The buffers that some patterns build on the heap while they are shown: the
+// expanded palette of the coordinate palette patterns and the angle index of the
+// analog clock (Map.cpp), and the brightness and rainbow tables of Pride and color
+// waves (WaveKernels.cpp).  Each pattern draws the same frames when the heap is too
+// short for its buffer, and the host time per frame with and without it.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_PIXELS 1024 // Fibonacci1024
+#define PRODUCT_FIBONACCI1024
+#define IS_FIBONACCI 1
+#define HAS_COORDINATE_MAP 1
+#include "../../esp8266-fastled-webserver/common.h"
+
+// While heapRefused, the code under test gets no heap, as on a device short of it
+static bool heapRefused = false;
+static void* testMalloc(size_t size) { return heapRefused ? nullptr : malloc(size); }
+static void* testCalloc(size_t count, size_t size) { return heapRefused ? nullptr : calloc(count, size); }
+#define malloc testMalloc
+#define calloc testCalloc
+#include "../../esp8266-fastled-webserver/Map.cpp"
+#include "../../esp8266-fastled-webserver/NtpClock.cpp"
+#include "../../esp8266-fastled-webserver/SwarKernels.cpp"
+#include "../../esp8266-fastled-webserver/WaveKernels.cpp"
+#include "../../esp8266-fastled-webserver/PridePlayground.cpp"
+#include "../../esp8266-fastled-webserver/ColorWavesPlayground.cpp"
+#undef malloc
+#undef calloc
+
+CRGB leds[NUM_PIXELS];
+CRGBPalette16 gCurrentPalette(CloudColors_p);
+const CRGBPalette16 palettes[] = { RainbowColors_p, LavaColors_p };
+uint8_t currentPaletteIndex = 0;
+uint8_t clockBackgroundFade = 240;
+uint8_t speed = 30;
+
+typedef void (*Pattern)();
+
+struct NamedPattern {
+  const char* name;
+  Pattern pattern;
+  uint16_t bufferBytes; // of heap, while shown
+};
+
+static void analogClock() { drawAnalogClock(); }
+
+static const NamedPattern PATTERNS[] = {
+  { "anglePalette",         anglePalette,          sizeof(CRGB) * 256 },
+  { "radiusPalette",        radiusPalette,         sizeof(CRGB) * 256 },
+  { "xyPalette",            xyPalette,             sizeof(CRGB) * 256 },
+  { "xyGradientPalette",    xyGradientPalette,     sizeof(CRGB) * 256 },
+  { "drawAnalogClock",      analogClock,           sizeof(AngleIndex) },
+  { "pridePlayground",      pridePlayground,       256 + sizeof(CRGB) * 256 },
+  { "colorWavesPlayground", colorWavesPlayground,  256 },
+};
+static const uint8_t PATTERN_COUNT = sizeof(PATTERNS) / sizeof(PATTERNS[0]);
+static const uint8_t FIRST_WAVE_PATTERN = 5; // draw within 2 of the exact brightness
+
+static void releaseBuffers() {
+  releaseMapBuffers();
+  releaseWaveTables();
+}
+
+static uint32_t hashOfLeds() {
+  uint32_t hash = 2166136261u; // FNV-1a
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(leds);
+  for (size_t i = 0; i < sizeof(leds); i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static void drawFrames(Pattern pattern, uint32_t* hashes, uint16_t frames) {
+  hostMillis() = 0; // so that the clock's EVERY_N_MILLIS() fires at the same frames each run
+  pattern();
+  fill_solid(leds, NUM_PIXELS, CRGB(0, 0, 0));
+  for (uint16_t frame = 0; frame < frames; frame++) {
+    hostMillis() = 1000 + frame * 97;
+    pattern();
+    hashes[frame] = hashOfLeds();
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {
+  heapRefused = false;
+  releaseBuffers();
+}
+
+void test_same_frames_without_heap(void) {
+  static const uint16_t FRAMES = 300;
+  static uint32_t withBuffer[FRAMES], withoutBuffer[FRAMES];
+  for (uint8_t n = 0; n < FIRST_WAVE_PATTERN; n++) {
+    heapRefused = false;
+    drawFrames(PATTERNS[n].pattern, withBuffer, FRAMES);
+    releaseBuffers();
+    heapRefused = true;
+    drawFrames(PATTERNS[n].pattern, withoutBuffer, FRAMES);
+    TEST_ASSERT_TRUE(angleIndex == nullptr);
+    TEST_ASSERT_TRUE(expandedPalette == nullptr);
+    if (memcmp(withBuffer, withoutBuffer, sizeof(withBuffer)) != 0) {
+      char message[64];
+      snprintf(message, sizeof(message), "%s: frames differ", PATTERNS[n].name);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+void test_xy_is_the_wrapped_sum(void) {
+  hostMillis() = 12345;
+  xyPalette();
+  const uint8_t beat = beat8(speed);
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    const uint8_t xy = coordsX[i] + coordsY[i];
+    TEST_ASSERT_TRUE(leds[i] == ColorFromPalette(palettes[currentPaletteIndex], beat - xy));
+  }
+}
+
+void test_buffers_freed_and_rebuilt(void) {
+  analogClock();
+  anglePalette();
+  pridePlayground();
+  TEST_ASSERT_NOT_NULL(angleIndex);
+  TEST_ASSERT_NOT_NULL(expandedPalette);
+  TEST_ASSERT_NOT_NULL(brightnessTable);
+  TEST_ASSERT_NOT_NULL(rainbowTable);
+  releaseBuffers();
+  TEST_ASSERT_NULL(angleIndex);
+  TEST_ASSERT_NULL(expandedPalette);
+  TEST_ASSERT_NULL(brightnessTable);
+  TEST_ASSERT_NULL(rainbowTable);
+  releaseBuffers(); // again, as on every pattern change
+  analogClock();
+  TEST_ASSERT_NOT_NULL(angleIndex);
+}
+
+template <typename Frame>
+static double microsPerFrame(Frame frameFunction) {
+  static const int FRAMES = 300;
+  double best = 1e9;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+      hostMillis() = frame * 16;
+      frameFunction();
+    }
+    const double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    if (micros < best) best = micros;
+  }
+  return best / FRAMES;
+}
+
+// Host numbers: what each buffer saves per frame of its pattern, against the bytes
+// of heap it takes while shown; not Xtensa cycles.
+void test_benchmark_host_time_per_frame(void) {
+  for (uint8_t n = 0; n < PATTERN_COUNT; n++) {
+    const NamedPattern& pattern = PATTERNS[n];
+    heapRefused = false;
+    const double buffered = microsPerFrame(pattern.pattern);
+    releaseBuffers();
+    heapRefused = true;
+    const double unbuffered = microsPerFrame(pattern.pattern);
+    heapRefused = false;
+    char message[160];
+    snprintf(message, sizeof(message), "%-20s %u pixels: no buffer %.1f us/frame, buffer %.1f us/frame (%.2fx), %u bytes",
+             pattern.name, (unsigned)NUM_PIXELS, unbuffered, buffered, unbuffered / buffered, (unsigned)pattern.bufferBytes);
+    TEST_MESSAGE(message);
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_same_frames_without_heap);
+  RUN_TEST(test_xy_is_the_wrapped_sum);
+  RUN_TEST(test_buffers_freed_and_rebuilt);
+  RUN_TEST(test_benchmark_host_time_per_frame);
+  return UNITY_END();
+}
@@ -0,0 +1,174 @@
+// checkPingTimer() (Ping.cpp) against a stand-in for the discovery server, whose
+// HTTPS POST blocks for as long as a BearSSL handshake on an ESP8266: posts are
+// sent only while the frames are idle, a ping that falls due while animating is
+// skipped until the next interval, and the lookup never blocks.  The loop runs
+// as on an ESP8266, the ping check and one frame per iteration, and the longest
+// gap between two animating frames stays at the frame period.
+
+#include <unity.h>
+
+#include <stdio.h>
+
+#define ENABLE_DISCOVERY 1
+#define ENERGY_GOVERNOR 1
+#define LOG_LEVEL LOG_LEVEL_INFO
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/include/EnergyGovernor.hpp"
+#include "../../esp8266-fastled-webserver/Log.cpp"
+#include "../../esp8266-fastled-webserver/Ping.cpp"
+
+String nameString = "Fibonacci256-0001";
+
+static const uint32_t FRAME_MILLIS     = 1000 / 60;
+static const uint32_t HANDSHAKE_MILLIS = 2500; // the stand-in's time per POST, about a TLS handshake on an ESP8266
+static const uint32_t MINUTE_MILLIS    = 60000;
+
+static GovernorState framesState = GOVERNOR_ACTIVE;
+GovernorStats governorStats() {
+  return GovernorStats { framesState, false, 0, 0, 0, 0, 0, 0, {} };
+}
+
+struct Post {
+  uint32_t atMillis;
+  GovernorState framesState;
+  uint32_t timeoutMillis;
+  bool toServer;
+};
+static Post posts[64];
+static uint8_t postCount = 0;
+static String lastBody;
+
+int hostHttpsPost(const String& url, const String& body, uint32_t timeoutMillis) {
+  if (postCount < sizeof(posts) / sizeof(posts[0])) {
+    posts[postCount++] = Post { hostMillis(), framesState, timeoutMillis, url == serverName };
+  }
+  lastBody = body;
+  hostMillis() += HANDSHAKE_MILLIS; // the whole loop waits for it
+  return 200;
+}
+
+// Longest time between the starts of two consecutive frames drawn while animating
+static uint32_t maxActiveGap = 0;
+static uint32_t lastActiveFrame = 0;
+static bool previousFrameActive = false;
+
+static void runLoop(uint32_t millis) {
+  const uint32_t end = hostMillis() + millis;
+  while ((int32_t)(hostMillis() - end) < 0) {
+    checkPingTimer();
+    const bool active = (framesState == GOVERNOR_ACTIVE);
+    if (active && previousFrameActive) {
+      maxActiveGap = max(maxActiveGap, hostMillis() - lastActiveFrame);
+    }
+    lastActiveFrame = hostMillis();
+    previousFrameActive = active;
+    hostMillis() += FRAME_MILLIS;
+  }
+}
+
+// A ping is due at the next check
+void setUp(void) {
+  hostMillis() = 5 * 60 * MINUTE_MILLIS;
+  hostDns() = HostDns();
+  WiFi.connected = true;
+  pingState = PING_WAITING;
+  lastPingTime = hostMillis() - PING_INTERVAL_MILLIS - 1;
+  framesState = GOVERNOR_ACTIVE;
+  postCount = 0;
+  maxActiveGap = 0;
+  previousFrameActive = false;
+}
+void tearDown(void) {}
+
+void test_never_posts_while_animating(void) {
+  const uint32_t logged = logCopy(0, lastBody);
+  runLoop(120 * MINUTE_MILLIS);
+  TEST_ASSERT_EQUAL_UINT8(0, postCount);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_MILLIS, maxActiveGap);
+  String log;
+  logCopy(logged, log);
+  TEST_ASSERT_TRUE(log.indexOf("Ping skipped: frames are animating") >= 0);
+}
+
+void test_posts_once_per_interval_while_idle(void) {
+  framesState = GOVERNOR_STATIC;
+  runLoop(60 * MINUTE_MILLIS + 1);
+  TEST_ASSERT_EQUAL_UINT8(6, postCount);
+  for (uint8_t i = 1; i < postCount; i++) {
+    TEST_ASSERT_UINT32_WITHIN(HANDSHAKE_MILLIS + 2 * FRAME_MILLIS, PING_INTERVAL_MILLIS, posts[i].atMillis - posts[i - 1].atMillis);
+  }
+  TEST_ASSERT_TRUE(posts[0].toServer);
+  TEST_ASSERT_EQUAL_UINT32(PING_TIMEOUT_MILLIS, posts[0].timeoutMillis);
+  TEST_ASSERT_TRUE(lastBody.indexOf("\"deviceName\":\"Fibonacci256-0001\"") >= 0);
+  TEST_ASSERT_TRUE(lastBody.indexOf("\"localIp\":\"192.168.1.10\"") >= 0);
+}
+
+void test_skipped_when_animating_starts_during_the_lookup(void) {
+  hostDns().cached = false;
+  framesState = GOVERNOR_STATIC;
+  runLoop(FRAME_MILLIS);
+  TEST_ASSERT_EQUAL_UINT8(PING_RESOLVING, pingState);
+
+  framesState = GOVERNOR_ACTIVE;
+  hostDnsAnswer(true);
+  runLoop(PING_INTERVAL_MILLIS - MINUTE_MILLIS);
+  TEST_ASSERT_EQUAL_UINT8(0, postCount);
+  TEST_ASSERT_EQUAL_UINT8(PING_WAITING, pingState);
+
+  // not before the next interval, even once idle
+  framesState = GOVERNOR_STATIC;
+  runLoop(MINUTE_MILLIS - 2 * FRAME_MILLIS);
+  TEST_ASSERT_EQUAL_UINT8(0, postCount);
+  runLoop(6 * FRAME_MILLIS);
+  TEST_ASSERT_EQUAL_UINT8(1, postCount);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_MILLIS, maxActiveGap);
+}
+
+void test_lookup_never_blocks(void) {
+  hostDns().cached = false;
+  framesState = GOVERNOR_STATIC;
+  runLoop(PING_RESOLVE_MILLIS + 2 * FRAME_MILLIS); // the server never answers
+  TEST_ASSERT_EQUAL_UINT8(0, postCount);
+  TEST_ASSERT_EQUAL_UINT8(PING_WAITING, pingState);
+  TEST_ASSERT_EQUAL_UINT32(1, hostDns().lookups);
+}
+
+void test_no_ping_without_wifi(void) {
+  WiFi.connected = false;
+  framesState = GOVERNOR_STATIC;
+  runLoop(30 * MINUTE_MILLIS);
+  TEST_ASSERT_EQUAL_UINT8(0, postCount);
+  TEST_ASSERT_EQUAL_UINT32(0, hostDns().lookups);
+}
+
+// Patterns that go static now and then, for a few hours: each post happens while
+// idle, and animating frames are never late
+void test_frame_gap_within_budget_while_animating(void) {
+  static const uint32_t PHASES[] = { 7, 3, 11, 2, 13, 1, 9, 4, 17, 5, 8, 6 }; // minutes, alternately animating and static
+  for (uint8_t round = 0; round < 3; round++) {
+    for (uint8_t i = 0; i < sizeof(PHASES) / sizeof(PHASES[0]); i++) {
+      framesState = (i % 2 == 0) ? GOVERNOR_ACTIVE : GOVERNOR_STATIC;
+      runLoop(PHASES[i] * MINUTE_MILLIS);
+    }
+  }
+  TEST_ASSERT_TRUE(postCount > 0);
+  for (uint8_t i = 0; i < postCount; i++) {
+    TEST_ASSERT_TRUE(posts[i].framesState != GOVERNOR_ACTIVE);
+  }
+  char message[128];
+  snprintf(message, sizeof(message), "%u pings in %u minutes, all while static; longest gap between animating frames %u ms",
+           (unsigned)postCount, 3u * 86u, (unsigned)maxActiveGap);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_MILLIS, maxActiveGap);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_never_posts_while_animating);
+  RUN_TEST(test_posts_once_per_interval_while_idle);
+  RUN_TEST(test_skipped_when_animating_starts_during_the_lookup);
+  RUN_TEST(test_lookup_never_blocks);
+  RUN_TEST(test_no_ping_without_wifi);
+  RUN_TEST(test_frame_gap_within_budget_while_animating);
+  return UNITY_END();
+}
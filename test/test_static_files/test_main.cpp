@@ -0,0 +1,242 @@
+// The static file path (AssetIndex.cpp, handleFileRead() in FSBrowser.cpp) over the
+// web app in data/, on a LittleFS stand-in that counts what each request costs it:
+// building the index reads only the directories and the kept hashes once every
+// file was hashed, a request is one lookup, a 304 touches no file, and the host
+// throughput of 200 and 304 responses against the handleFileRead() that walked
+// LittleFS for each request.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/FSBrowser.cpp"
+#include "../../esp8266-fastled-webserver/AssetIndex.cpp"
+#include "../../esp8266-fastled-webserver/Transfers.cpp"
+
+ESP8266WebServer webServer;
+
+// handleFileRead() before the asset index, without its Serial.println()
+namespace baseline {
+  bool handleFileRead(String path){
+    if (path.endsWith("/")) {
+      path += "index.htm";
+    }
+    String contentType = getContentType(path);
+    String pathWithGz = path + ".gz";
+    if (MYFS.exists(pathWithGz) || MYFS.exists(path)) {
+      if (MYFS.exists(pathWithGz)) {
+        path = pathWithGz;
+      }
+      File file = MYFS.open(path, "r");
+      (void)webServer.streamFile(file, contentType);
+      file.close();
+
+      return true;
+    }
+    return false;
+  }
+}
+
+static std::vector<String> requestPaths; // of every file in data/, as requested
+static uint64_t dataBytes = 0;
+
+// data/, with write times, and the path a browser requests each file by
+static void loadData() {
+  dataBytes = hostLoadWebApp();
+  requestPaths.clear();
+  for (std::map<std::string, HostFileData>::iterator i = LittleFS.files.begin(); i != LittleFS.files.end(); ++i) {
+    std::string request = i->first;
+    if (request.size() > 3 && request.compare(request.size() - 3, 3, ".gz") == 0) {
+      request.resize(request.size() - 3);
+    }
+    requestPaths.push_back(String(request.c_str()));
+  }
+}
+
+static void resetStats() {
+  LittleFS.stats = HostFSStats();
+}
+
+// Sends the rest of the response, as the loop would between frames
+static void finishTransfers() {
+  for (int i = 0; (i < 100000) && transfersPending(); i++) {
+    hostAdvanceMicros(1000);
+    pumpTransfers(1000);
+  }
+  TEST_ASSERT_FALSE(transfersPending());
+}
+
+static std::map<String, String> ifNoneMatch(const String& etag) {
+  std::map<String, String> headers;
+  headers[String("If-None-Match")] = etag;
+  return headers;
+}
+
+void setUp(void) {
+  loadData();
+  buildAssetIndex();
+  resetStats();
+}
+void tearDown(void) {}
+
+// After the first boot, the directories and the kept hashes; a new file is hashed
+void test_boot_hashes_only_new_files(void) {
+  resetStats();
+  const auto start = std::chrono::steady_clock::now();
+  buildAssetIndex();
+  const double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  const uint32_t hashesBytes = LittleFS.files[ASSET_HASH_FILE].content.size();
+  TEST_ASSERT_EQUAL_UINT16(requestPaths.size(), assetCount());
+  TEST_ASSERT_EQUAL_UINT32(1, LittleFS.stats.opens);
+  TEST_ASSERT_EQUAL_UINT32(hashesBytes, (uint32_t)LittleFS.stats.bytesRead);
+  char message[160];
+  snprintf(message, sizeof(message), "%u files, %llu bytes: %u directories listed, %u bytes of kept hashes read, %.1f us on the host",
+           (unsigned)assetCount(), (unsigned long long)dataBytes, (unsigned)LittleFS.stats.dirs, (unsigned)hashesBytes, micros);
+  TEST_MESSAGE(message);
+
+  LittleFS.files["/new.js"].content = "// new";
+  LittleFS.files["/new.js"].lastWrite = 12;
+  resetStats();
+  buildAssetIndex();
+  TEST_ASSERT_EQUAL_UINT32(hashesBytes + 6, (uint32_t)LittleFS.stats.bytesRead);
+  TEST_ASSERT_NOT_NULL(findAsset("/new.js"));
+  resetStats();
+  buildAssetIndex();
+  TEST_ASSERT_EQUAL_UINT32(1, LittleFS.stats.opens);
+}
+
+// The first boot of a new image, with or without write times, reads every file, once
+void test_first_boot_hashes_every_file(void) {
+  for (std::map<std::string, HostFileData>::iterator i = LittleFS.files.begin(); i != LittleFS.files.end(); ++i) {
+    i->second.lastWrite = 0;
+  }
+  LittleFS.remove(ASSET_HASH_FILE);
+  resetStats();
+  buildAssetIndex();
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)dataBytes, (uint32_t)LittleFS.stats.bytesRead);
+  char message[96];
+  snprintf(message, sizeof(message), "first boot: %u files opened, %llu bytes read",
+           (unsigned)LittleFS.stats.opens, (unsigned long long)LittleFS.stats.bytesRead);
+  TEST_MESSAGE(message);
+  resetStats();
+  buildAssetIndex();
+  TEST_ASSERT_EQUAL_UINT32(1, LittleFS.stats.opens);
+}
+
+void test_etag_follows_writes_and_deletes(void) {
+  const String etag = assetETag(*findAsset("/js/app.js"));
+  File file = LittleFS.open("/js/app.js", "w");
+  const char content[] = "// rewritten";
+  file.write(reinterpret_cast<const uint8_t*>(content), sizeof(content) - 1);
+  file.close();
+  refreshAsset("/js/app.js");
+  const Asset* asset = findAsset("/js/app.js");
+  TEST_ASSERT_NOT_NULL(asset);
+  TEST_ASSERT_TRUE(assetETag(*asset) != etag);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(content) - 1, asset->size);
+
+  // the same size, in the same second: write times alone would not tell
+  const String rewritten = assetETag(*asset);
+  file = LittleFS.open("/js/app.js", "w");
+  const char other[] = "// Rewritten";
+  file.write(reinterpret_cast<const uint8_t*>(other), sizeof(other) - 1);
+  file.close();
+  refreshAsset("/js/app.js");
+  TEST_ASSERT_TRUE(assetETag(*findAsset("/js/app.js")) != rewritten);
+  buildAssetIndex(); // and the next boot keeps it
+  TEST_ASSERT_TRUE(assetETag(*findAsset("/js/app.js")) != rewritten);
+  TEST_ASSERT_NULL(findAsset(ASSET_HASH_FILE));
+
+  LittleFS.remove("/js/app.js");
+  refreshAsset("/js/app.js");
+  TEST_ASSERT_NULL(findAsset("/js/app.js"));
+
+  // a .gz file takes precedence over the plain one
+  file = LittleFS.open("/new.css", "w");
+  file.close();
+  refreshAsset("new.css");
+  TEST_ASSERT_FALSE(findAsset("/new.css")->gzipped);
+  file = LittleFS.open("/new.css.gz", "w");
+  file.close();
+  refreshAsset("new.css.gz");
+  TEST_ASSERT_TRUE(findAsset("/new.css")->gzipped);
+}
+
+void test_one_lookup_and_304_without_the_file_system(void) {
+  for (size_t i = 0; i < requestPaths.size(); i++) {
+    const String& path = requestPaths[i];
+    const Asset* asset = findAsset(path);
+    TEST_ASSERT_NOT_NULL(asset);
+    const std::string& expected = LittleFS.files[asset->gzipped ? std::string(path.c_str()) + ".gz" : path.c_str()].content;
+
+    resetStats();
+    WiFiClient client = webServer.request(path);
+    TEST_ASSERT_TRUE(handleFileRead(path));
+    finishTransfers();
+    TEST_ASSERT_EQUAL_INT(200, webServer.code);
+    TEST_ASSERT_EQUAL_UINT32(1, LittleFS.stats.opens);
+    TEST_ASSERT_EQUAL_UINT32(0, LittleFS.stats.exists);
+    TEST_ASSERT_EQUAL_UINT32(asset->gzipped, webServer.responseHeaders.count("Content-Encoding"));
+    const std::string& received = client.connection()->received;
+    TEST_ASSERT_TRUE(received.size() >= expected.size());
+    TEST_ASSERT_TRUE(received.compare(received.size() - expected.size(), expected.size(), expected) == 0);
+
+    resetStats();
+    webServer.request(path, std::map<String, String>(), ifNoneMatch(webServer.responseHeaders["ETag"]));
+    TEST_ASSERT_TRUE(handleFileRead(path));
+    TEST_ASSERT_EQUAL_INT(304, webServer.code);
+    TEST_ASSERT_EQUAL_UINT32(0, LittleFS.stats.opens + LittleFS.stats.exists + LittleFS.stats.dirs);
+  }
+  resetStats();
+  webServer.request("/missing.js");
+  TEST_ASSERT_FALSE(handleFileRead("/missing.js"));
+  TEST_ASSERT_EQUAL_UINT32(0, LittleFS.stats.opens + LittleFS.stats.exists);
+}
+
+// Host time per request, and LittleFS lookups (each a walk from the root directory
+// on the device) per request.  The body is sent by the network stand-in after the
+// handler returns, which is not counted.
+template <typename Handler>
+static void report(const char* name, Handler handler, bool revalidate) {
+  static const int ROUNDS = 20;
+  resetStats();
+  double micros = 0;
+  uint32_t requests = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    for (size_t i = 0; i < requestPaths.size(); i++) {
+      const String& path = requestPaths[i];
+      const String etag = assetETag(*findAsset(path));
+      webServer.request(path, std::map<String, String>(), revalidate ? ifNoneMatch(etag) : std::map<String, String>());
+      const auto start = std::chrono::steady_clock::now();
+      handler(path);
+      micros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+      requests++;
+      finishTransfers();
+    }
+  }
+  char message[160];
+  snprintf(message, sizeof(message), "%-22s %6.2f us/request on the host, %.2f LittleFS lookups/request",
+           name, micros / requests, (double)(LittleFS.stats.opens + LittleFS.stats.exists) / requests);
+  TEST_MESSAGE(message);
+}
+
+void test_benchmark_static_path(void) {
+  hostNetwork().bytesPerMilli = 1000000; // so the stand-in's network time does not dominate
+  report("baseline 200", baseline::handleFileRead, false);
+  report("baseline, revalidated", baseline::handleFileRead, true);
+  report("index 200", handleFileRead, false);
+  report("index 304", handleFileRead, true);
+  hostNetwork() = HostNetwork();
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_hashes_only_new_files);
+  RUN_TEST(test_first_boot_hashes_every_file);
+  RUN_TEST(test_etag_follows_writes_and_deletes);
+  RUN_TEST(test_one_lookup_and_304_without_the_file_system);
+  RUN_TEST(test_benchmark_static_path);
+  return UNITY_END();
+}
@@ -0,0 +1,168 @@
+// nscale8Packed(), fadeToBlackByPacked(), nblendPacked() and RowBlender (SwarKernels.cpp)
+// against FastLED's per-pixel nscale8() and nblend(): byte-for-byte equal for every
+// scale and amount, every alignment and the counts around the word boundaries, and
+// the host time per pixel of both.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_PIXELS 1024
+#define SWAR_PIXEL_KERNELS 1
+#include "../../esp8266-fastled-webserver/SwarKernels.cpp"
+
+CRGB leds[NUM_PIXELS];
+
+static const uint16_t COUNTS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 13, 16, 17, 63, 64, 65, 341, 1021 };
+static const uint16_t COUNT_COUNT = sizeof(COUNTS) / sizeof(COUNTS[0]);
+
+static uint32_t lcgState = 12345;
+static uint8_t nextByte() {
+  lcgState = lcgState * 1664525u + 1013904223u;
+  return (uint8_t)(lcgState >> 24);
+}
+
+// Bytes of an arbitrary alignment, with a guard pixel either side to catch overruns
+struct Pixels {
+  alignas(4) uint8_t bytes[sizeof(CRGB) * (NUM_PIXELS + 2) + 4];
+  CRGB* at(uint8_t offset) { return reinterpret_cast<CRGB*>(bytes + offset) + 1; }
+  void randomize() {
+    for (size_t i = 0; i < sizeof(bytes); i++) bytes[i] = nextByte();
+  }
+};
+
+static Pixels expected, actual, overlay;
+
+static void assertSame(const char* what, unsigned value, uint8_t offset, uint16_t count) {
+  if (memcmp(expected.bytes, actual.bytes, sizeof(actual.bytes)) != 0) {
+    char message[96];
+    snprintf(message, sizeof(message), "%s %u: offset %u, %u pixels", what, value, (unsigned)offset, (unsigned)count);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_nscale8_matches_fastled(void) {
+  for (unsigned scale = 0; scale < 256; scale++) {
+    for (uint8_t offset = 0; offset < 4; offset++) {
+      for (uint16_t c = 0; c < COUNT_COUNT; c++) {
+        expected.randomize();
+        memcpy(actual.bytes, expected.bytes, sizeof(actual.bytes));
+        nscale8(expected.at(offset), COUNTS[c], scale);
+        nscale8Packed(actual.at(offset), COUNTS[c], scale);
+        assertSame("scale", scale, offset, COUNTS[c]);
+      }
+    }
+  }
+}
+
+void test_fade_to_black_by_matches_fastled(void) {
+  for (unsigned fadeBy = 0; fadeBy < 256; fadeBy++) {
+    expected.randomize();
+    memcpy(actual.bytes, expected.bytes, sizeof(actual.bytes));
+    fadeToBlackBy(expected.at(1), 341, fadeBy);
+    fadeToBlackByPacked(actual.at(1), 341, fadeBy);
+    assertSame("fadeBy", fadeBy, 1, 341);
+  }
+}
+
+void test_nblend_matches_fastled(void) {
+  for (unsigned amount = 0; amount < 256; amount++) {
+    // both alignments equal (word path) and different (byte path)
+    for (uint8_t offset = 0; offset < 4; offset++) {
+      for (uint8_t overlayOffset = 0; overlayOffset < 4; overlayOffset++) {
+        for (uint16_t c = 0; c < COUNT_COUNT; c++) {
+          expected.randomize();
+          overlay.randomize();
+          memcpy(actual.bytes, expected.bytes, sizeof(actual.bytes));
+          nblend(expected.at(offset), overlay.at(overlayOffset), COUNTS[c], amount);
+          nblendPacked(actual.at(offset), overlay.at(overlayOffset), COUNTS[c], amount);
+          assertSame("amount", amount, offset, COUNTS[c]);
+        }
+      }
+    }
+  }
+}
+
+template <PixelOrder ORDER>
+static void assertRowBlenderMatchesNblend() {
+  static CRGB reference[NUM_PIXELS];
+  static CRGB colors[NUM_PIXELS];
+  for (unsigned amount = 0; amount < 256; amount += 5) {
+    for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+      leds[i] = CRGB(nextByte(), nextByte(), nextByte());
+      colors[i] = CRGB(nextByte(), nextByte(), nextByte());
+    }
+    memcpy(reference, leds, sizeof(leds));
+    // a range that starts and ends part way through a chunk
+    const uint16_t first = 5, last = NUM_PIXELS - 9;
+    for (uint16_t i = first; i < last; i++) {
+      nblend(reference[physicalPixelIndex(ORDER, i)], colors[i], amount);
+    }
+    LogicalPixels<ORDER> pixels;
+    RowBlender<ORDER> blender(pixels, first, amount);
+    for (uint16_t i = first; i < last; i++) {
+      blender.push(colors[i]);
+    }
+    blender.flush();
+    TEST_ASSERT_EQUAL_MEMORY(reference, leds, sizeof(leds));
+  }
+}
+
+void test_row_blender_matches_nblend(void) {
+  assertRowBlenderMatchesNblend<PIXEL_ORDER_LINEAR>();
+  assertRowBlenderMatchesNblend<PIXEL_ORDER_REVERSED>();
+}
+
+// Nanoseconds per pixel, best of several runs over all NUM_PIXELS.
+template <typename Kernel>
+static double nanosPerPixel(Kernel kernel) {
+  static const int RUNS = 2000;
+  double best = 1e9;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < RUNS; run++) {
+      kernel((uint8_t)run);
+    }
+    const double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (nanos < best) best = nanos;
+  }
+  return best / RUNS / NUM_PIXELS;
+}
+
+static void report(const char* name, double fastled, double packed) {
+  char message[128];
+  snprintf(message, sizeof(message), "%-8s FastLED %.2f ns/pixel, packed %.2f ns/pixel, %.2fx",
+           name, fastled, packed, fastled / packed);
+  TEST_MESSAGE(message);
+}
+
+// Host numbers: the ratio on the Xtensa cores differs (no unaligned or vector loads),
+// but a packed kernel slower than FastLED here would point at a regression.
+void test_benchmark_host_time_per_pixel(void) {
+  CRGB* a = expected.at(0);
+  const CRGB* b = overlay.at(0);
+  expected.randomize();
+  overlay.randomize();
+
+  const double scaleFastled = nanosPerPixel([&](uint8_t v) { nscale8(a, NUM_PIXELS, v | 0x80); });
+  const double scalePacked  = nanosPerPixel([&](uint8_t v) { nscale8Packed(a, NUM_PIXELS, v | 0x80); });
+  report("nscale8", scaleFastled, scalePacked);
+
+  const double blendFastled = nanosPerPixel([&](uint8_t v) { nblend(a, b, NUM_PIXELS, (v % 253) + 1); });
+  const double blendPacked  = nanosPerPixel([&](uint8_t v) { nblendPacked(a, b, NUM_PIXELS, (v % 253) + 1); });
+  report("nblend", blendFastled, blendPacked);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_nscale8_matches_fastled);
+  RUN_TEST(test_fade_to_black_by_matches_fastled);
+  RUN_TEST(test_nblend_matches_fastled);
+  RUN_TEST(test_row_blender_matches_nblend);
+  RUN_TEST(test_benchmark_host_time_per_pixel);
+  return UNITY_END();
+}
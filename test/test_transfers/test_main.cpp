@@ -0,0 +1,148 @@
+// Static file transfers (Transfers.cpp) interleaved with frames by the energy
+// governor (EnergyGovernor.cpp), in a loop like the sketch's: pumpTransfers() in
+// handleNetwork(), then a frame.  Before, with the governor, transfers were only
+// pumped while it slept, so a body larger than what the first chunk sent never
+// progressed while frames overran, and a stalled client held its slot for good.
+// Now each loop sends at least one chunk, and drops stalled clients.  Reports the
+// longest gap between frames, and how long a large body takes, before and after.
+
+#include <unity.h>
+
+#include <stdio.h>
+
+#define ENERGY_GOVERNOR 1
+#define FRAMES_PER_SECOND 60
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/include/EnergyGovernor.hpp"
+#include "../../esp8266-fastled-webserver/Log.cpp"
+#include "../../esp8266-fastled-webserver/EnergyGovernor.cpp"
+#include "../../esp8266-fastled-webserver/Transfers.cpp"
+
+ESP8266WebServer webServer;
+CRGB leds[NUM_PIXELS];
+
+static const uint32_t BODY_BYTES = 163872; // bootstrap-5.1.3.min.css
+static char body[BODY_BYTES];
+
+static const uint32_t ON_TIME_MICROS = 4000;  // a pattern drawn well within the frame period
+static const uint32_t OVERRUN_MICROS = 110000; // one that is not, even stretched to its longest, so the governor never sleeps
+static const uint32_t SHOW_MICROS    = 7700;  // 256 pixels of WS2812
+static const uint32_t OVERRUN_LOOP_MILLIS = (OVERRUN_MICROS + SHOW_MICROS) / 1000 + 1;
+
+static RenderParameters parameters;
+
+typedef struct {
+  uint32_t maxFrameGapMillis;
+  uint32_t transferMillis; // until the body was taken by the network; zero when it was not
+} Run;
+
+// One iteration of loop(): handleNetwork()'s pumpTransfers(), which was not
+// called with the governor before, then renderFrame() drawing a new frame
+static void loopOnce(bool pumpEveryLoop, uint32_t renderMicros) {
+  if (pumpEveryLoop) {
+    pumpTransfers(TRANSFER_LOOP_MICROS);
+  }
+  if (!governorBeginFrame(parameters)) {
+    governorWait();
+    return;
+  }
+  leds[0].r++; // the pattern animates
+  hostAdvanceMicros(renderMicros);
+  governorFrameDrawn();
+  governorShowAndWait();
+}
+
+// Starts sending the body, then loops for up to millis
+static void run(Run& result, bool pumpEveryLoop, uint32_t renderMicros, uint32_t millis) {
+  stats.maxFrameGapMillis = 0;
+  previousFrameActive = false;
+  WiFiClient client = webServer.request("/css/bootstrap-5.1.3.min.css");
+  const uint32_t start = hostMillis();
+  transferFlash(body, BODY_BYTES);
+  result.transferMillis = 0;
+  while (hostMillis() - start < millis) {
+    loopOnce(pumpEveryLoop, renderMicros);
+    if ((result.transferMillis == 0) && !transfersPending() && (client.availableForWrite() == hostNetwork().sendBufferBytes)) {
+      result.transferMillis = hostMillis() - start;
+    }
+  }
+  result.maxFrameGapMillis = governorStats().maxFrameGapMillis;
+}
+
+void setUp(void) {
+  hostNetwork() = HostNetwork();
+  FastLED.showMicros = SHOW_MICROS;
+  parameters = RenderParameters { 1, 255, 0, 0, CRGB(0, 0, 0) };
+  memset(body, 'x', sizeof(body));
+}
+
+// Frees the slots a test left busy
+void tearDown(void) {
+  for (uint8_t i = 0; i < TRANSFER_SLOTS; i++) {
+    finish(transfers[i]);
+  }
+}
+
+static void report(const char* name, const Run& before, const Run& after) {
+  char message[200];
+  snprintf(message, sizeof(message), "%-8s before: frame gap %3u ms, body %5u ms;  after: frame gap %3u ms, body %5u ms",
+           name, (unsigned)before.maxFrameGapMillis, (unsigned)before.transferMillis,
+           (unsigned)after.maxFrameGapMillis, (unsigned)after.transferMillis);
+  TEST_MESSAGE(message);
+}
+
+// Frames within the period: the governor's sleep sends most of the body, as before
+void test_frames_on_time(void) {
+  Run before, after;
+  run(before, false, ON_TIME_MICROS, 5000);
+  tearDown();
+  run(after, true, ON_TIME_MICROS, 5000);
+  report("on time", before, after);
+  TEST_ASSERT_TRUE(before.transferMillis > 0);
+  TEST_ASSERT_TRUE(after.transferMillis > 0);
+  TEST_ASSERT_TRUE(after.transferMillis <= before.transferMillis);
+  TEST_ASSERT_UINT32_WITHIN(1, FRAME_MILLIS, before.maxFrameGapMillis);
+  TEST_ASSERT_TRUE(after.maxFrameGapMillis <= FRAME_MILLIS + TRANSFER_LOOP_MICROS / 1000 + 1);
+}
+
+void test_frames_overrun(void) {
+  Run before, after;
+  run(before, false, OVERRUN_MICROS, 10000);
+  tearDown();
+  run(after, true, OVERRUN_MICROS, 10000);
+  report("overrun", before, after);
+  TEST_ASSERT_EQUAL_UINT32(0, before.transferMillis); // never finished
+  TEST_ASSERT_TRUE(after.transferMillis > 0);
+  TEST_ASSERT_TRUE(after.maxFrameGapMillis <= before.maxFrameGapMillis + TRANSFER_LOOP_MICROS / 1000 + 1);
+}
+
+// A client that stops taking data, while frames overrun: its slot is freed
+void test_stalled_client_dropped_while_frames_overrun(void) {
+  WiFiClient client = webServer.request("/css/bootstrap-5.1.3.min.css");
+  transferFlash(body, BODY_BYTES);
+  hostNetwork().bytesPerMilli = 0;
+  const uint32_t start = hostMillis();
+  while (transfersPending() && (hostMillis() - start < 3 * TRANSFER_STALL_MILLIS)) {
+    loopOnce(true, OVERRUN_MICROS);
+  }
+  TEST_ASSERT_FALSE(transfersPending());
+  TEST_ASSERT_FALSE(client.connected());
+  TEST_ASSERT_TRUE(hostMillis() - start <= TRANSFER_STALL_MILLIS + 2 * OVERRUN_LOOP_MILLIS);
+
+  // before, nothing looked at it again
+  client = webServer.request("/css/bootstrap-5.1.3.min.css");
+  transferFlash(body, BODY_BYTES);
+  for (uint32_t i = 0; i < 3 * TRANSFER_STALL_MILLIS / OVERRUN_LOOP_MILLIS; i++) {
+    loopOnce(false, OVERRUN_MICROS);
+  }
+  TEST_ASSERT_TRUE(transfersPending());
+  TEST_ASSERT_TRUE(client.connected());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_on_time);
+  RUN_TEST(test_frames_overrun);
+  RUN_TEST(test_stalled_client_dropped_while_frames_overrun);
+  return UNITY_END();
+}
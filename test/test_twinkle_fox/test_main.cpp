@@ -0,0 +1,157 @@
+// drawTwinkles() (TwinkleFOX.cpp) with and without TWINKLEFOX_PIXEL_TABLE, for several
+// product sizes: both paths draw the same frames, the table is freed and rebuilt, and
+// the host time per pixel of each path.
+//
+// TwinkleFOX.cpp is built once per (size, option) into its own namespace, so one test
+// can run them side by side.  All instances draw into the same leds[].
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_PIXELS 1628 // the largest instance, so leds[] holds every size
+#define TWINKLEFOX_PIXEL_TABLE 0
+#include "../../esp8266-fastled-webserver/common.h"
+
+CRGB leds[NUM_PIXELS];
+
+#undef NUM_PIXELS
+#undef TWINKLEFOX_PIXEL_TABLE
+#define NUM_PIXELS 64
+#define TWINKLEFOX_PIXEL_TABLE 0
+namespace computed64 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+#undef TWINKLEFOX_PIXEL_TABLE
+#define TWINKLEFOX_PIXEL_TABLE 1
+namespace table64 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+
+#undef NUM_PIXELS
+#undef TWINKLEFOX_PIXEL_TABLE
+#define NUM_PIXELS 256
+#define TWINKLEFOX_PIXEL_TABLE 0
+namespace computed256 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+#undef TWINKLEFOX_PIXEL_TABLE
+#define TWINKLEFOX_PIXEL_TABLE 1
+namespace table256 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+
+#undef NUM_PIXELS
+#undef TWINKLEFOX_PIXEL_TABLE
+#define NUM_PIXELS 1024
+#define TWINKLEFOX_PIXEL_TABLE 0
+namespace computed1024 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+#undef TWINKLEFOX_PIXEL_TABLE
+#define TWINKLEFOX_PIXEL_TABLE 1
+namespace table1024 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+
+#undef NUM_PIXELS
+#undef TWINKLEFOX_PIXEL_TABLE
+#define NUM_PIXELS 1628
+#define TWINKLEFOX_PIXEL_TABLE 0
+namespace computed1628 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+#undef TWINKLEFOX_PIXEL_TABLE
+#define TWINKLEFOX_PIXEL_TABLE 1
+namespace table1628 {
+  #include "../../esp8266-fastled-webserver/TwinkleFOX.cpp"
+}
+
+typedef void (*Pattern)();
+
+struct Instance {
+  uint16_t pixels;
+  Pattern computed;
+  Pattern table;
+  Pattern release; // frees the table
+  const void* const* tableAddress;
+};
+
+#define INSTANCE(n) { n, computed##n::partyTwinkles, table##n::partyTwinkles, table##n::releaseTwinkleFoxPixels, \
+                      reinterpret_cast<const void* const*>(&table##n::twinklePixels) }
+static const Instance INSTANCES[] = { INSTANCE(64), INSTANCE(256), INSTANCE(1024), INSTANCE(1628) };
+static const uint8_t INSTANCE_COUNT = sizeof(INSTANCES) / sizeof(INSTANCES[0]);
+
+static CRGB expected[NUM_PIXELS];
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_table_draws_the_same_frames(void) {
+  for (uint8_t n = 0; n < INSTANCE_COUNT; n++) {
+    const Instance& instance = INSTANCES[n];
+    for (uint32_t ms = 0; ms < 120000; ms += 997) {
+      hostMillis() = ms;
+      instance.computed();
+      memcpy(expected, leds, sizeof(CRGB) * instance.pixels);
+      instance.table();
+      TEST_ASSERT_EQUAL_MEMORY(expected, leds, sizeof(CRGB) * instance.pixels);
+    }
+    instance.release();
+  }
+}
+
+void test_table_freed_and_rebuilt(void) {
+  const Instance& instance = INSTANCES[2];
+  instance.table();
+  TEST_ASSERT_NOT_NULL(*instance.tableAddress);
+  instance.release();
+  TEST_ASSERT_NULL(*instance.tableAddress);
+  instance.release(); // again, as on every pattern change
+  TEST_ASSERT_NULL(*instance.tableAddress);
+  instance.table();
+  TEST_ASSERT_NOT_NULL(*instance.tableAddress);
+  instance.release();
+}
+
+template <typename Frame>
+static double nanosPerPixel(uint16_t pixels, Frame frameFunction) {
+  static const int FRAMES = 500;
+  double best = 1e9;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+      hostMillis() = frame * 16;
+      frameFunction();
+    }
+    const double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (nanos < best) best = nanos;
+  }
+  return best / FRAMES / pixels;
+}
+
+// Host numbers: they show how much of a frame the table saves at each size, and
+// what building it on the first frame costs, not Xtensa cycles.
+void test_benchmark_host_time_per_pixel(void) {
+  for (uint8_t n = 0; n < INSTANCE_COUNT; n++) {
+    const Instance& instance = INSTANCES[n];
+    const double computed = nanosPerPixel(instance.pixels, instance.computed);
+    const double table = nanosPerPixel(instance.pixels, instance.table);
+    // the first frame of the pattern, which also builds the table
+    const double first = nanosPerPixel(instance.pixels, [&]() { instance.release(); instance.table(); });
+    instance.release();
+    char message[160];
+    snprintf(message, sizeof(message), "%4u pixels: computed %.2f ns/pixel, table %.2f ns/pixel (%.2fx), first frame %.2f ns/pixel, table %u bytes",
+             (unsigned)instance.pixels, computed, table, computed / table, first, (unsigned)(4 * instance.pixels));
+    TEST_MESSAGE(message);
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_table_draws_the_same_frames);
+  RUN_TEST(test_table_freed_and_rebuilt);
+  RUN_TEST(test_benchmark_host_time_per_pixel);
+  return UNITY_END();
+}
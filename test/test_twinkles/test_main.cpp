@@ -0,0 +1,219 @@
+// colortwinkles() (Twinkles.cpp), which steps a list of the lit pixels, against the
+// version that stepped every pixel: the same frames at full density on a large panel
+// (the list never limits spawning), and the host time per step of both.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_PIXELS 1024 // Fibonacci1024
+#include "../../esp8266-fastled-webserver/common.h"
+
+CRGB leds[NUM_PIXELS];
+CRGBPalette16 gCurrentPalette;
+
+static RenderParameters parameters = { 1, 255, 0, 0, CRGB(0, 0, 0) };
+const RenderParameters& renderParameters() {
+  return parameters;
+}
+
+namespace list {
+  #include "../../esp8266-fastled-webserver/Twinkles.cpp"
+}
+
+// colortwinkles() before the list of lit pixels, unchanged
+namespace baseline {
+  #undef STARTING_BRIGHTNESS
+  #undef FADE_IN_SPEED
+  #undef FADE_OUT_SPEED
+  #undef DENSITY
+  #define STARTING_BRIGHTNESS 64
+  #define FADE_IN_SPEED       32
+  #define FADE_OUT_SPEED      20
+  #define DENSITY            255
+
+  enum { GETTING_DARKER = 0, GETTING_BRIGHTER = 1 };
+
+  CRGB makeBrighter( const CRGB& color, fract8 howMuchBrighter)
+  {
+    CRGB incrementalColor = color;
+    incrementalColor.nscale8( howMuchBrighter);
+    return color + incrementalColor;
+  }
+
+  CRGB makeDarker( const CRGB& color, fract8 howMuchDarker)
+  {
+    CRGB newcolor = color;
+    newcolor.nscale8( 255 - howMuchDarker);
+    return newcolor;
+  }
+
+  uint8_t  directionFlags[ (NUM_PIXELS + 7) / 8];
+
+  bool getPixelDirection( uint16_t i)
+  {
+    uint16_t index = i / 8;
+    uint8_t  bitNum = i & 0x07;
+
+    uint8_t  andMask = 1 << bitNum;
+    return (directionFlags[index] & andMask) != 0;
+  }
+
+  void setPixelDirection( uint16_t i, bool dir)
+  {
+    uint16_t index = i / 8;
+    uint8_t  bitNum = i & 0x07;
+
+    uint8_t  orMask = 1 << bitNum;
+    uint8_t andMask = 255 - orMask;
+    uint8_t value = directionFlags[index] & andMask;
+    if ( dir ) {
+      value += orMask;
+    }
+    directionFlags[index] = value;
+  }
+
+  void brightenOrDarkenEachPixel( fract8 fadeUpAmount, fract8 fadeDownAmount)
+  {
+    for ( uint16_t i = 0; i < NUM_PIXELS; i++) {
+      if ( getPixelDirection(i) == GETTING_DARKER) {
+        leds[i] = makeDarker( leds[i], fadeDownAmount);
+      } else {
+        leds[i] = makeBrighter( leds[i], fadeUpAmount);
+        if ( leds[i].r == 255 || leds[i].g == 255 || leds[i].b == 255) {
+          setPixelDirection(i, GETTING_DARKER);
+        }
+      }
+    }
+  }
+
+  void colortwinkles()
+  {
+    EVERY_N_MILLIS(30)
+    {
+      brightenOrDarkenEachPixel( FADE_IN_SPEED, FADE_OUT_SPEED);
+
+      if ( random8() < DENSITY ) {
+        int pos = random16(NUM_PIXELS);
+        if ( !leds[pos]) {
+          leds[pos] = ColorFromPalette( gCurrentPalette, random8(), STARTING_BRIGHTNESS, NOBLEND);
+          setPixelDirection(pos, GETTING_BRIGHTER);
+        }
+      }
+    }
+  }
+}
+
+static const uint32_t FRAMES = 20000;    // 10 ms apart, so a step every third frame
+static uint32_t frameHashes[FRAMES];
+
+static uint32_t hashOfLeds() {
+  uint32_t hash = 2166136261u; // FNV-1a
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(leds);
+  for (size_t i = 0; i < sizeof(leds); i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static void startRun(const CRGBPalette16& palette) {
+  fill_solid(leds, NUM_PIXELS, CRGB(0, 0, 0));
+  random16_set_seed(1337);
+  gCurrentPalette = palette;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void assertSameFrames(const char* name, const CRGBPalette16& palette) {
+  hostMillis() = 1000000;
+  startRun(palette);
+  for (uint32_t frame = 0; frame < FRAMES; frame++) {
+    hostMillis() += 10;
+    baseline::colortwinkles();
+    frameHashes[frame] = hashOfLeds();
+  }
+
+  hostMillis() = 1000000;
+  startRun(palette);
+  uint8_t mostListed = 0;
+  for (uint32_t frame = 0; frame < FRAMES; frame++) {
+    hostMillis() += 10;
+    list::colortwinkles();
+    if (list::activeTwinkleCount > mostListed) mostListed = list::activeTwinkleCount;
+    if (hashOfLeds() != frameHashes[frame]) {
+      char message[80];
+      snprintf(message, sizeof(message), "%s: frame %u differs", name, (unsigned)frame);
+      TEST_FAIL_MESSAGE(message);
+      return;
+    }
+  }
+  char message[96];
+  snprintf(message, sizeof(message), "%s: at most %u of %u list entries used",
+           name, (unsigned)mostListed, (unsigned)list::maxActiveTwinkles);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(mostListed < list::maxActiveTwinkles);
+}
+
+void test_same_frames_as_baseline(void) {
+  const CRGB w(85, 85, 85), W(CRGB::White), l(0xE1A024);
+  assertSameFrames("cloud", CloudColors_p);
+  assertSameFrames("rainbow", RainbowColors_p);
+  assertSameFrames("snow", CRGBPalette16( W, W, W, W, w, w, w, w, w, w, w, w, w, w, w, w ));
+  assertSameFrames("incandescent", CRGBPalette16( l, l, l, l, l, l, l, l, l, l, l, l, l, l, l, l ));
+}
+
+void test_list_capacity_is_the_longest_twinkle(void) {
+  // the dimmest twinkle that brightens at all, from start to black
+  CRGB pixel(list::dimmestBrighteningChannel, 0, 0);
+  uint16_t steps = 0;
+  bool brighter = true;
+  while (pixel) {
+    if (brighter) {
+      pixel = list::makeBrighter(pixel, FADE_IN_SPEED);
+      brighter = (pixel.r != 255);
+    } else {
+      pixel = list::makeDarker(pixel, FADE_OUT_SPEED);
+    }
+    steps++;
+  }
+  TEST_ASSERT_EQUAL_UINT16(steps, list::longestTwinkleSteps);
+  TEST_ASSERT_EQUAL_UINT8(list::makeBrighter(CRGB(list::dimmestBrighteningChannel - 1, 0, 0), FADE_IN_SPEED).r,
+                          list::dimmestBrighteningChannel - 1);
+}
+
+template <typename Pattern>
+static double microsPerStep(Pattern pattern) {
+  static const uint32_t STEPS = 3000;
+  startRun(RainbowColors_p);
+  hostMillis() = 2000000;
+  for (uint32_t i = 0; i < 200; i++) { // fill the panel to its steady state
+    hostMillis() += 30;
+    pattern();
+  }
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < STEPS; i++) {
+    hostMillis() += 30;
+    pattern();
+  }
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / STEPS;
+}
+
+// Host numbers: the saving scales with NUM_PIXELS against the ~60 lit pixels.
+void test_benchmark_host_time_per_step(void) {
+  const double baselineMicros = microsPerStep(baseline::colortwinkles);
+  const double listMicros = microsPerStep(list::colortwinkles);
+  char message[128];
+  snprintf(message, sizeof(message), "%u pixels: every pixel %.2f us/step, lit pixels %.2f us/step, %.1fx",
+           (unsigned)NUM_PIXELS, baselineMicros, listMicros, baselineMicros / listMicros);
+  TEST_MESSAGE(message);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_same_frames_as_baseline);
+  RUN_TEST(test_list_capacity_is_the_longest_twinkle);
+  RUN_TEST(test_benchmark_host_time_per_step);
+  return UNITY_END();
+}
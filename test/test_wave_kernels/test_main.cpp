@@ -0,0 +1,259 @@
+// BrightnessWave and RainbowTable (WaveKernels.cpp) against the per-pixel math they
+// replace: the interpolated brightness is within 2 of the exact value, the rainbow
+// is identical to hsv2rgb_rainbow(), Pride and color waves draw frames that differ
+// by a few steps of a channel at most, and the host time per frame of both, for the
+// product sizes either side of the NUM_PIXELS >= 256 gate.  Also, that the linear and
+// Fibonacci versions of each pattern continue one animation.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define NUM_PIXELS 1024 // Fibonacci1024
+#define IS_FIBONACCI 1
+#include "../../esp8266-fastled-webserver/common.h"
+
+// While heapRefused, the tables are not built, and every value is computed
+static bool heapRefused = false;
+static void* testMalloc(size_t size) { return heapRefused ? nullptr : malloc(size); }
+#define malloc testMalloc
+#include "../../esp8266-fastled-webserver/SwarKernels.cpp"
+#include "../../esp8266-fastled-webserver/WaveKernels.cpp"
+#include "../../esp8266-fastled-webserver/PridePlayground.cpp"
+#include "../../esp8266-fastled-webserver/ColorWavesPlayground.cpp"
+#undef malloc
+
+CRGB leds[NUM_PIXELS];
+CRGBPalette16 gCurrentPalette(OceanColors_p);
+
+// Any permutation will do; this one is fixed by the seed
+alignas(4) static uint16_t fibonacciToPhysical_p[NUM_PIXELS];
+MapTable<fibonacci_index_t> fibonacciToPhysical(fibonacciToPhysical_p);
+
+static void shuffleFibonacciToPhysical() {
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    fibonacciToPhysical_p[i] = i;
+  }
+  random16_set_seed(4321);
+  for (uint16_t i = NUM_PIXELS - 1; i > 0; i--) {
+    const uint16_t j = random16(i + 1);
+    const uint16_t swap = fibonacciToPhysical_p[i];
+    fibonacciToPhysical_p[i] = fibonacciToPhysical_p[j];
+    fibonacciToPhysical_p[j] = swap;
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {
+  heapRefused = false;
+  releaseWaveTables();
+}
+
+void test_brightness_within_two_of_exact(void) {
+  uint32_t equal = 0, total = 0;
+  for (uint16_t depth = 0; depth < 256; depth++) {
+    BrightnessWave brightness(depth);
+    for (uint32_t theta = 0; theta < 65536; theta++) {
+      const int16_t exact = BrightnessWave::exact(theta, depth);
+      const int16_t interpolated = brightness(theta);
+      TEST_ASSERT_UINT8_WITHIN(2, exact, interpolated);
+      equal += (exact == interpolated);
+      total++;
+    }
+  }
+  char message[64];
+  snprintf(message, sizeof(message), "%.1f%% of values exact", 100.0 * equal / total);
+  TEST_MESSAGE(message);
+}
+
+void test_rainbow_equals_hsv2rgb(void) {
+  for (uint16_t sat = 0; sat < 256; sat++) {
+    RainbowTable rainbow(sat);
+    for (uint16_t hue = 0; hue < 256; hue++) {
+      for (uint16_t val = 0; val < 256; val++) {
+        CRGB expected;
+        hsv2rgb_rainbow(CHSV(hue, sat, val), expected);
+        TEST_ASSERT_TRUE(rainbow(hue, val) == expected);
+      }
+    }
+  }
+}
+
+void test_computed_without_heap(void) {
+  heapRefused = true;
+  BrightnessWave brightness(171);
+  RainbowTable rainbow(230);
+  TEST_ASSERT_NULL(brightnessTable);
+  TEST_ASSERT_NULL(rainbowTable);
+  for (uint32_t theta = 0; theta < 65536; theta += 7) {
+    TEST_ASSERT_EQUAL_UINT8(BrightnessWave::exact(theta, 171), brightness(theta));
+  }
+  CRGB expected;
+  hsv2rgb_rainbow(CHSV(100, 230, 77), expected);
+  TEST_ASSERT_TRUE(rainbow(100, 77) == expected);
+}
+
+// Largest and mean difference of any channel, between frames drawn with the
+// tables and frames computed exactly, from the same starting frame and time
+static void compareFrames(const char* name, void (*pattern)()) {
+  static const uint16_t FRAMES = 2000;
+  static CRGB exact[NUM_PIXELS], tabulated[NUM_PIXELS];
+  fill_solid(exact, NUM_PIXELS, CRGB(0, 0, 0));
+  fill_solid(tabulated, NUM_PIXELS, CRGB(0, 0, 0));
+  uint8_t largest = 0;
+  double sum = 0;
+  for (uint16_t frame = 0; frame < FRAMES; frame++) {
+    hostMillis() = 5000 + frame * 13;
+    pattern(); // advances the pattern's clock, drawing a frame that is discarded
+
+    // no more time passes, so both draw with the same parameters
+    memcpy(leds, exact, sizeof(leds));
+    heapRefused = true;
+    releaseWaveTables();
+    pattern();
+    memcpy(exact, leds, sizeof(leds));
+
+    memcpy(leds, tabulated, sizeof(leds));
+    heapRefused = false;
+    pattern();
+    memcpy(tabulated, leds, sizeof(leds));
+
+    for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+      for (uint8_t c = 0; c < 3; c++) {
+        const uint8_t difference = abs(exact[i].raw[c] - tabulated[i].raw[c]);
+        largest = max(largest, difference);
+        sum += difference;
+      }
+    }
+  }
+  char message[128];
+  snprintf(message, sizeof(message), "%-20s channels differ by %u at most, %.3f on average",
+           name, (unsigned)largest, sum / FRAMES / NUM_PIXELS / 3);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(largest <= 4);
+}
+
+void test_frames_match_exact_math(void) {
+  compareFrames("pridePlayground", pridePlayground);
+  compareFrames("colorWavesPlayground", colorWavesPlayground);
+}
+
+// Each frame is drawn from black, and read back in the pattern's logical order,
+// so that frames in either order can be compared
+template <PixelOrder ORDER>
+static void drawLogicalFrame(void (*pattern)(), CRGB* logical) {
+  fill_solid(leds, NUM_PIXELS, CRGB(0, 0, 0));
+  pattern();
+  for (uint16_t i = 0; i < NUM_PIXELS; i++) {
+    logical[i] = leds[physicalPixelIndex(ORDER, i)];
+  }
+}
+
+static void resetAnimations() {
+  sPridePlaygroundPseudotime = sPridePlaygroundLastMillis = sPridePlaygroundHue16 = 0;
+  sColorwavesPlaygroundPseudotime = sColorwavesPlaygroundLastMillis = sColorwavesPlaygroundHue16 = 0;
+}
+
+static void assertOneAnimation(const char* name, void (*linear)(), void (*fibonacci)()) {
+  static const uint16_t FRAMES = 600;
+  static CRGB expected[FRAMES / 50][NUM_PIXELS];
+  static CRGB actual[NUM_PIXELS];
+  // only the linear version, keeping the frames after each switch below
+  resetAnimations();
+  for (uint16_t frame = 0; frame < FRAMES; frame++) {
+    hostMillis() = 7000 + frame * 16;
+    drawLogicalFrame<PIXEL_ORDER_REVERSED>(linear, (frame % 50 == 0) ? expected[frame / 50] : actual);
+  }
+  // switching order every 50 frames
+  resetAnimations();
+  for (uint16_t frame = 0; frame < FRAMES; frame++) {
+    hostMillis() = 7000 + frame * 16;
+    if ((frame / 50) % 2 != 0) {
+      drawLogicalFrame<PIXEL_ORDER_REVERSED_FIBONACCI>(fibonacci, actual);
+    } else {
+      drawLogicalFrame<PIXEL_ORDER_REVERSED>(linear, actual);
+    }
+    if ((frame % 50 == 0) && (memcmp(expected[frame / 50], actual, sizeof(actual)) != 0)) {
+      char message[64];
+      snprintf(message, sizeof(message), "%s: frame %u differs", name, (unsigned)frame);
+      TEST_FAIL_MESSAGE(message);
+      return;
+    }
+  }
+}
+
+void test_both_orders_continue_one_animation(void) {
+  shuffleFibonacciToPhysical();
+  assertOneAnimation("pridePlayground", pridePlayground, pridePlaygroundFibonacci);
+  assertOneAnimation("colorWavesPlayground", colorWavesPlayground, colorWavesPlaygroundFibonacci);
+}
+
+template <typename Frame>
+static double nanosPerFrame(Frame frameFunction) {
+  static const int FRAMES = 2000;
+  double best = 1e9;
+  for (int attempt = 0; attempt < 5; attempt++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+      frameFunction((uint16_t)frame);
+    }
+    const double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (nanos < best) best = nanos;
+  }
+  return best / FRAMES;
+}
+
+static volatile uint32_t sink;
+
+// Pride's per-pixel work for `pixels` pixels.  The table inputs change every frame,
+// or as often as Pride changes them at 60 frames per second.
+static double pridePixels(uint16_t pixels, bool tables, bool inputsEveryFrame) {
+  heapRefused = !tables;
+  releaseWaveTables();
+  const double nanos = nanosPerFrame([&](uint16_t frame) {
+    hostMillis() = frame * 16;
+    const uint8_t depth = inputsEveryFrame ? 96 + (frame & 0x7F) : beatsin88(171, 96, 224);
+    const uint8_t sat = inputsEveryFrame ? 220 + (frame & 0x1F) : beatsin88(43.5, 220, 250);
+    BrightnessWave brightness(depth);
+    RainbowTable rainbow(sat);
+    uint16_t theta = frame * 997, hue = frame * 331;
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < pixels; i++) {
+      theta += 7777;
+      hue += 100;
+      const CRGB color = rainbow(hue >> 8, brightness(theta));
+      total += color.r + color.g + color.b;
+    }
+    sink = total;
+  });
+  heapRefused = false;
+  return nanos;
+}
+
+// Host numbers, not Xtensa cycles.  With inputs changing every frame (the worst case
+// for the tables), rebuilding them costs more than computing fewer than 256 pixels,
+// hence the gate.
+void test_benchmark_host_time_per_frame(void) {
+  static const uint16_t SIZES[] = { 32, 64, 128, 256, 512, 1024 };
+  for (uint8_t n = 0; n < sizeof(SIZES) / sizeof(SIZES[0]); n++) {
+    const double computed = pridePixels(SIZES[n], false, false);
+    const double worst = pridePixels(SIZES[n], true, true);
+    const double typical = pridePixels(SIZES[n], true, false);
+    char message[160];
+    snprintf(message, sizeof(message), "%4u pixels: computed %.2f us/frame; tables rebuilt every frame %.2f us (%.2fx), as Pride %.2f us (%.2fx)",
+             (unsigned)SIZES[n], computed / 1000, worst / 1000, computed / worst, typical / 1000, computed / typical);
+    TEST_MESSAGE(message);
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_brightness_within_two_of_exact);
+  RUN_TEST(test_rainbow_equals_hsv2rgb);
+  RUN_TEST(test_computed_without_heap);
+  RUN_TEST(test_frames_match_exact_math);
+  RUN_TEST(test_both_orders_continue_one_animation);
+  RUN_TEST(test_benchmark_host_time_per_frame);
+  return UNITY_END();
+}
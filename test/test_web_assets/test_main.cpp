@@ -0,0 +1,183 @@
+// The web app compiled into the firmware (WebAssets.cpp, with EMBED_WEB_ASSETS),
+// against the same files on LittleFS: a bundled file is sent from flash without
+// touching the file system, a download is sent as stored (no Content-Encoding)
+// on both paths, and what a page load of index.htm costs each, in bytes, in time
+// on the network stand-in, and in host CPU time per request.
+//
+// The bundle is include/generated/WebAssets.h, which pio-scripts/embed-web-assets.py
+// generates from data/ before the native tests are built.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#define EMBED_WEB_ASSETS 1
+#include "../../esp8266-fastled-webserver/common.h"
+#include "../../esp8266-fastled-webserver/FSBrowser.cpp"
+#include "../../esp8266-fastled-webserver/AssetIndex.cpp"
+#include "../../esp8266-fastled-webserver/Transfers.cpp"
+#include "../../esp8266-fastled-webserver/WebAssets.cpp"
+
+ESP8266WebServer webServer;
+
+// What index.htm loads from the device when the CDNs cannot be reached, as on a
+// network without internet access
+static const char* const PAGE[] = {
+  "/index.htm",
+  "/css/bootstrap-5.1.3.min.css",
+  "/css/minicolors-2.3.6.min.css",
+  "/css/bootstrap-icons-1.7.2.min.css",
+  "/css/styles.css",
+  "/images/atom196.png",
+  "/images/github.ico",
+  "/js/jquery-3.6.0.min.js",
+  "/js/bootstrap-5.1.3.min.js",
+  "/js/jquery.minicolors-2.3.6.min.js",
+  "/js/r-websocket-1.0.0.min.js",
+  "/js/FileSaver-2.0.5.min.js",
+  "/js/app.js",
+};
+static const uint8_t PAGE_FILES = sizeof(PAGE) / sizeof(PAGE[0]);
+
+// Only the bundle: LittleFS is empty, as on a device that never had data/ uploaded
+static void useBundle() {
+  LittleFS.files.clear();
+  buildAssetIndex();
+  LittleFS.stats = HostFSStats();
+}
+
+static void useFileSystem() {
+  hostLoadWebApp();
+  buildAssetIndex();
+  LittleFS.stats = HostFSStats();
+}
+
+static std::map<String, String> downloadArgs() {
+  std::map<String, String> args;
+  args[String("download")] = String("true");
+  return args;
+}
+
+void setUp(void) {
+  hostNetwork() = HostNetwork();
+}
+void tearDown(void) {
+  for (int i = 0; (i < 100000) && transfersPending(); i++) {
+    hostAdvanceMicros(1000);
+    pumpTransfers(1000);
+  }
+}
+
+void test_bundle_served_without_the_file_system(void) {
+  useBundle();
+  TEST_ASSERT_EQUAL_UINT16(WEB_ASSET_COUNT, webAssetCount());
+  for (uint16_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    WebAsset asset;
+    memcpy_P(&asset, &webAssets[i], sizeof(asset));
+    const String path = webAssetPaths + asset.pathOffset;
+    WiFiClient client = webServer.request(path);
+    TEST_ASSERT_TRUE(handleFileRead(path));
+    tearDown();
+    TEST_ASSERT_EQUAL_INT(200, webServer.code);
+    TEST_ASSERT_EQUAL_UINT32(asset.size, webServer.contentLength);
+    TEST_ASSERT_EQUAL_UINT32(asset.gzipped, webServer.responseHeaders.count("Content-Encoding"));
+    const std::string& received = client.connection()->received;
+    TEST_ASSERT_TRUE(received.size() >= asset.size);
+    TEST_ASSERT_EQUAL_MEMORY(webAssetData + asset.offset, received.data() + received.size() - asset.size, asset.size);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, LittleFS.stats.opens + LittleFS.stats.exists);
+  webServer.request("/missing.js");
+  TEST_ASSERT_FALSE(handleFileRead("/missing.js"));
+}
+
+// A download gets the bytes as stored, gzipped or not, and says nothing of their encoding
+void test_download_is_sent_as_stored(void) {
+  useBundle();
+  webServer.request("/js/app.js", downloadArgs());
+  TEST_ASSERT_TRUE(handleFileRead("/js/app.js"));
+  TEST_ASSERT_EQUAL_UINT32(0, webServer.responseHeaders.count("Content-Encoding"));
+  TEST_ASSERT_TRUE(webServer.contentType == "application/octet-stream");
+  tearDown();
+
+  webServer.request("/js/app.js");
+  TEST_ASSERT_TRUE(handleFileRead("/js/app.js"));
+  TEST_ASSERT_TRUE(webServer.responseHeaders["Content-Encoding"] == "gzip");
+  TEST_ASSERT_TRUE(webServer.contentType == "application/javascript");
+  tearDown();
+
+  // the same from LittleFS, with a gzipped file
+  LittleFS.files["/js/app.js.gz"].content = "gzipped";
+  refreshAsset("/js/app.js.gz");
+  LittleFS.stats = HostFSStats();
+  webServer.request("/js/app.js", downloadArgs());
+  TEST_ASSERT_TRUE(handleFileRead("/js/app.js"));
+  TEST_ASSERT_EQUAL_UINT32(0, webServer.responseHeaders.count("Content-Encoding"));
+  TEST_ASSERT_TRUE(webServer.contentType == "application/octet-stream");
+  TEST_ASSERT_EQUAL_UINT32(1, LittleFS.stats.opens);
+}
+
+typedef struct {
+  uint64_t bytes;       // of the responses, headers included
+  uint32_t loadMicros;  // from the first request until the last byte is taken by the network
+  double   cpuMicros;   // host time in the handlers and in pumpTransfers()
+} PageLoad;
+
+// The requests one after the other, as on one connection; the loop pumps the
+// transfers every millisecond
+static void loadPage(PageLoad& load) {
+  load = PageLoad { 0, 0, 0 };
+  const uint32_t start = micros();
+  for (uint8_t i = 0; i < PAGE_FILES; i++) {
+    const String path = PAGE[i];
+    WiFiClient client = webServer.request(path);
+    std::chrono::steady_clock::time_point cpuStart = std::chrono::steady_clock::now();
+    TEST_ASSERT_TRUE(handleFileRead(path));
+    load.cpuMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - cpuStart).count();
+    while (transfersPending() || (client.availableForWrite() < hostNetwork().sendBufferBytes)) {
+      hostAdvanceMicros(1000);
+      cpuStart = std::chrono::steady_clock::now();
+      pumpTransfers(1000);
+      load.cpuMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - cpuStart).count();
+    }
+    load.bytes += client.connection()->received.size();
+  }
+  load.loadMicros = micros() - start;
+}
+
+static void report(const char* name, const PageLoad& load) {
+  char message[160];
+  snprintf(message, sizeof(message), "%-9s %7llu bytes, page load %4u ms on the stand-in network, %6.2f us host CPU/request",
+           name, (unsigned long long)load.bytes, (unsigned)(load.loadMicros / 1000), load.cpuMicros / PAGE_FILES);
+  TEST_MESSAGE(message);
+}
+
+void test_page_load(void) {
+  static const int ROUNDS = 20;
+  PageLoad bundle = { 0, 0, 0 };
+  PageLoad fileSystem = { 0, 0, 0 };
+  for (int round = 0; round < ROUNDS; round++) {
+    PageLoad fromFlash, fromFiles;
+    useBundle();
+    loadPage(fromFlash);
+    TEST_ASSERT_EQUAL_UINT32(0, LittleFS.stats.opens);
+    useFileSystem();
+    loadPage(fromFiles);
+    TEST_ASSERT_EQUAL_UINT32(PAGE_FILES, LittleFS.stats.opens);
+
+    bundle = PageLoad { fromFlash.bytes, fromFlash.loadMicros, bundle.cpuMicros + fromFlash.cpuMicros / ROUNDS };
+    fileSystem = PageLoad { fromFiles.bytes, fromFiles.loadMicros, fileSystem.cpuMicros + fromFiles.cpuMicros / ROUNDS };
+  }
+  report("bundle", bundle);
+  report("LittleFS", fileSystem);
+  TEST_ASSERT_TRUE(bundle.bytes < fileSystem.bytes);
+  TEST_ASSERT_TRUE(bundle.loadMicros < fileSystem.loadMicros);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bundle_served_without_the_file_system);
+  RUN_TEST(test_download_is_sent_as_stored);
+  RUN_TEST(test_page_load);
+  return UNITY_END();
+}